@@ -21,13 +21,11 @@
 
 #include <libdevcore/JSON.h>
 
+#include <libdevcore/Assertions.h>
 #include <libdevcore/CommonIO.h>
 
-#include <boost/algorithm/string/replace.hpp>
-
-#include <sstream>
-#include <map>
 #include <memory>
+#include <sstream>
 
 using namespace std;
 
@@ -42,17 +40,6 @@ namespace dev
 namespace
 {
 
-/// StreamWriterBuilder that can be constructed with specific settings
-class StreamWriterBuilder: public Json::StreamWriterBuilder
-{
-public:
-	explicit StreamWriterBuilder(map<string, Json::Value> const& _settings)
-	{
-		for (auto const& iter: _settings)
-			this->settings_[iter.first] = iter.second;
-	}
-};
-
 /// CharReaderBuilder with strict-mode settings
 class StrictModeCharReaderBuilder: public Json::CharReaderBuilder
 {
@@ -63,16 +50,88 @@ public:
 	}
 };
 
-/// Serialise the JSON object (@a _input) with specific builder (@a _builder)
-/// \param _input JSON input string
-/// \param _builder StreamWriterBuilder that is used to create new Json::StreamWriter
-/// \return serialized json object
-string print(Json::Value const& _input, Json::StreamWriterBuilder const& _builder)
-{
-	stringstream stream;
-	unique_ptr<Json::StreamWriter> writer(_builder.newStreamWriter());
-	writer->write(_input, &stream);
-	return stream.str();
+/// @returns the code point of the UTF-8 sequence starting at @a _it and moves @a _it to the
+/// last byte of the sequence. Invalid sequences result in the replacement character.
+/// This mirrors the decoding of jsoncpp, including the handling of invalid sequences.
+unsigned utf8ToCodepoint(char const*& _it, char const* _end)
+{
+	unsigned const replacementCharacter = 0xFFFD;
+	unsigned const firstByte = static_cast<unsigned char>(*_it);
+	auto byteAt = [&](size_t _offset) { return static_cast<unsigned>(static_cast<unsigned char>(_it[_offset])) & 0x3F; };
+
+	if (firstByte < 0x80)
+		return firstByte;
+	if (firstByte < 0xE0)
+	{
+		if (_end - _it < 2)
+			return replacementCharacter;
+		unsigned codepoint = ((firstByte & 0x1F) << 6) | byteAt(1);
+		_it += 1;
+		return codepoint < 0x80 ? replacementCharacter : codepoint;
+	}
+	if (firstByte < 0xF0)
+	{
+		if (_end - _it < 3)
+			return replacementCharacter;
+		unsigned codepoint = ((firstByte & 0x0F) << 12) | (byteAt(1) << 6) | byteAt(2);
+		_it += 2;
+		if (codepoint >= 0xD800 && codepoint <= 0xDFFF)
+			return replacementCharacter;
+		return codepoint < 0x800 ? replacementCharacter : codepoint;
+	}
+	if (firstByte < 0xF8)
+	{
+		if (_end - _it < 4)
+			return replacementCharacter;
+		unsigned codepoint = ((firstByte & 0x07) << 18) | (byteAt(1) << 12) | (byteAt(2) << 6) | byteAt(3);
+		_it += 3;
+		return codepoint < 0x10000 ? replacementCharacter : codepoint;
+	}
+	return replacementCharacter;
+}
+
+/// Writes the string between @a _begin and @a _end as a quoted JSON string to @a _out,
+/// escaping exactly the characters jsoncpp escapes.
+void writeQuoted(ostream& _out, char const* _begin, char const* _end)
+{
+	static char const hexDigits[] = "0123456789abcdef";
+	auto writeEscapedCodepoint = [&](unsigned _codepoint)
+	{
+		_out << "\\u";
+		for (int shift = 12; shift >= 0; shift -= 4)
+			_out << hexDigits[(_codepoint >> shift) & 0xF];
+	};
+
+	_out << '"';
+	for (char const* it = _begin; it != _end; ++it)
+		switch (*it)
+		{
+		case '"': _out << "\\\""; break;
+		case '\\': _out << "\\\\"; break;
+		case '\b': _out << "\\b"; break;
+		case '\f': _out << "\\f"; break;
+		case '\n': _out << "\\n"; break;
+		case '\r': _out << "\\r"; break;
+		case '\t': _out << "\\t"; break;
+		default:
+		{
+			unsigned codepoint = utf8ToCodepoint(it, _end);
+			if (0x20 <= codepoint && codepoint <= 0x7F)
+				_out << static_cast<char>(codepoint);
+			else if (codepoint < 0x10000)
+				writeEscapedCodepoint(codepoint);
+			else
+			{
+				// Characters outside of the basic multilingual plane are written as surrogate pairs.
+				// Like jsoncpp, this drops the excess bits of invalid code points above 0x10FFFF.
+				codepoint -= 0x10000;
+				writeEscapedCodepoint(((codepoint >> 10) & 0x3FF) + 0xD800);
+				writeEscapedCodepoint((codepoint & 0x3FF) + 0xDC00);
+			}
+			break;
+		}
+		}
+	_out << '"';
 }
 
 /// Parse a JSON string (@a _input) with specified builder (@ _builder) and writes resulting JSON object to (@a _json)
@@ -89,20 +148,186 @@ bool parse(Json::CharReaderBuilder& _builder, string const& _input, Json::Value&
 
 } // end anonymous namespace
 
+void JsonStreamWriter::key(string const& _name)
+{
+	assertThrow(!m_containers.empty() && m_containers.back().isObject, JsonWriterError, "Member name outside of object.");
+	assertThrow(!m_afterKey, JsonWriterError, "Member without value.");
+	Container& container = m_containers.back();
+	assertThrow(
+		container.empty || container.lastKey < _name,
+		JsonWriterError,
+		"Members have to be written in the order of their names."
+	);
+
+	openContainer();
+	if (!container.empty)
+		m_out << ',';
+	container.empty = false;
+	container.lastKey = _name;
+	if (m_pretty)
+		newLine(m_containers.size());
+	writeQuoted(m_out, _name.data(), _name.data() + _name.size());
+	m_out << ':';
+	m_afterKey = true;
+}
+
+void JsonStreamWriter::value(Json::Value const& _value)
+{
+	switch (_value.type())
+	{
+	case Json::objectValue:
+		beginObject();
+		for (string const& name: _value.getMemberNames())
+			member(name, _value[name]);
+		endObject();
+		return;
+	case Json::arrayValue:
+		beginArray();
+		for (Json::Value const& element: _value)
+			value(element);
+		endArray();
+		return;
+	default:
+		break;
+	}
+
+	prepareValue();
+	if (m_afterKey && m_pretty)
+		m_out << ' ';
+	m_afterKey = false;
+
+	switch (_value.type())
+	{
+	case Json::nullValue:
+		m_out << "null";
+		break;
+	case Json::intValue:
+		m_out << Json::valueToString(_value.asLargestInt());
+		break;
+	case Json::uintValue:
+		m_out << Json::valueToString(_value.asLargestUInt());
+		break;
+	case Json::realValue:
+		m_out << Json::valueToString(_value.asDouble());
+		break;
+	case Json::stringValue:
+	{
+		char const* begin = nullptr;
+		char const* end = nullptr;
+		if (_value.getString(&begin, &end))
+			writeQuoted(m_out, begin, end);
+		break;
+	}
+	case Json::booleanValue:
+		m_out << (_value.asBool() ? "true" : "false");
+		break;
+	default:
+		assertThrow(false, JsonWriterError, "Unknown JSON value type.");
+	}
+
+	if (m_containers.empty())
+		m_done = true;
+}
+
+void JsonStreamWriter::beginContainer(bool _isObject)
+{
+	prepareValue();
+	m_containers.emplace_back(Container{_isObject, m_afterKey, true, {}});
+	m_afterKey = false;
+	m_pendingOpen = true;
+}
+
+void JsonStreamWriter::endContainer(bool _isObject)
+{
+	assertThrow(
+		!m_containers.empty() && m_containers.back().isObject == _isObject,
+		JsonWriterError,
+		_isObject ? "Unbalanced end of object." : "Unbalanced end of array."
+	);
+	assertThrow(!m_afterKey, JsonWriterError, "Member without value.");
+
+	Container const& container = m_containers.back();
+	if (m_pendingOpen)
+	{
+		if (container.afterKey && m_pretty)
+			m_out << ' ';
+		m_out << (_isObject ? "{}" : "[]");
+		m_pendingOpen = false;
+	}
+	else
+	{
+		if (m_pretty)
+			newLine(m_containers.size() - 1);
+		m_out << (_isObject ? '}' : ']');
+	}
+
+	m_containers.pop_back();
+	if (m_containers.empty())
+		m_done = true;
+}
+
+void JsonStreamWriter::prepareValue()
+{
+	assertThrow(!m_done, JsonWriterError, "Value after the end of the document.");
+	if (m_containers.empty())
+		return;
+
+	Container& container = m_containers.back();
+	if (container.isObject)
+		assertThrow(m_afterKey, JsonWriterError, "Object member without name.");
+	else
+	{
+		openContainer();
+		if (!container.empty)
+			m_out << ',';
+		container.empty = false;
+		if (m_pretty)
+			newLine(m_containers.size());
+	}
+}
+
+void JsonStreamWriter::openContainer()
+{
+	if (!m_pendingOpen)
+		return;
+	m_pendingOpen = false;
+
+	Container const& container = m_containers.back();
+	// Non-empty values of object members start on a new line in pretty printing mode.
+	if (container.afterKey && m_pretty)
+		newLine(m_containers.size() - 1);
+	m_out << (container.isObject ? '{' : '[');
+}
+
+void JsonStreamWriter::newLine(size_t _depth)
+{
+	m_out << '\n';
+	for (size_t i = 0; i < _depth; ++i)
+		m_out << "  ";
+}
+
 string jsonPrettyPrint(Json::Value const& _input)
 {
-	static map<string, Json::Value> settings{{"indentation", "  "}, {"enableYAMLCompatibility", true}};
-	static StreamWriterBuilder writerBuilder(settings);
-	string result = print(_input, writerBuilder);
-	boost::replace_all(result, " \n", "\n");
-	return result;
+	ostringstream result;
+	jsonPrettyPrint(_input, result);
+	return result.str();
 }
 
 string jsonCompactPrint(Json::Value const& _input)
 {
-	static map<string, Json::Value> settings{{"indentation", ""}};
-	static StreamWriterBuilder writerBuilder(settings);
-	return print(_input, writerBuilder);
+	ostringstream result;
+	jsonCompactPrint(_input, result);
+	return result.str();
+}
+
+void jsonPrettyPrint(Json::Value const& _input, ostream& _out)
+{
+	JsonStreamWriter(_out, true).value(_input);
+}
+
+void jsonCompactPrint(Json::Value const& _input, ostream& _out)
+{
+	JsonStreamWriter(_out, false).value(_input);
 }
 
 bool jsonParseStrict(string const& _input, Json::Value& _json, string* _errs /* = nullptr */)
@@ -22,18 +22,87 @@
 
 #pragma once
 
+#include <libdevcore/Exceptions.h>
+
 #include <json/json.h>
 
+#include <ostream>
 #include <string>
+#include <vector>
 
 namespace dev {
 
+DEV_SIMPLE_EXCEPTION(JsonWriterError);
+
+/**
+ * Writes JSON to a stream while it is being produced, so that large documents do not have to
+ * be held in memory as a whole. Values can be provided as events (begin and end of objects and
+ * arrays, member names) or as complete Json::Value trees.
+ *
+ * The output is identical to the one of jsonPrettyPrint or jsonCompactPrint for the equivalent
+ * Json::Value. Since Json::Value orders the members of objects by name, the members of every
+ * object have to be written in that order.
+ */
+class JsonStreamWriter
+{
+public:
+	JsonStreamWriter(std::ostream& _out, bool _pretty): m_out(_out), m_pretty(_pretty) {}
+
+	void beginObject() { beginContainer(true); }
+	void endObject() { endContainer(true); }
+	void beginArray() { beginContainer(false); }
+	void endArray() { endContainer(false); }
+
+	/// Starts the member called @a _name of the current object. Has to be followed by its value.
+	void key(std::string const& _name);
+	/// Writes the complete value @a _value.
+	void value(Json::Value const& _value);
+	/// Writes the member called @a _name with value @a _value.
+	void member(std::string const& _name, Json::Value const& _value) { key(_name); value(_value); }
+
+	/// @returns true if the top-level value is complete.
+	bool done() const { return m_done; }
+
+private:
+	struct Container
+	{
+		bool isObject;
+		/// True if the container is the value of an object member.
+		bool afterKey;
+		bool empty = true;
+		std::string lastKey;
+	};
+
+	void beginContainer(bool _isObject);
+	void endContainer(bool _isObject);
+	/// Writes everything that has to precede a value in the current position.
+	void prepareValue();
+	/// Writes the opening bracket of the innermost container if it was not written yet.
+	void openContainer();
+	void newLine(size_t _depth);
+
+	std::ostream& m_out;
+	bool m_pretty = false;
+	std::vector<Container> m_containers;
+	/// True if a member name was written, but its value was not written yet.
+	bool m_afterKey = false;
+	/// True if the opening bracket of the innermost container is not written yet.
+	bool m_pendingOpen = false;
+	bool m_done = false;
+};
+
 /// Serialise the JSON object (@a _input) with indentation
 std::string jsonPrettyPrint(Json::Value const& _input);
 
 /// Serialise the JSON object (@a _input) without indentation
 std::string jsonCompactPrint(Json::Value const& _input);
 
+/// Serialise the JSON object (@a _input) with indentation directly to @a _out
+void jsonPrettyPrint(Json::Value const& _input, std::ostream& _out);
+
+/// Serialise the JSON object (@a _input) without indentation directly to @a _out
+void jsonCompactPrint(Json::Value const& _input, std::ostream& _out);
+
 /// Parse a JSON string (@a _input) with enabled strict-mode and writes resulting JSON object to (@a _json)
 /// \param _input JSON input string
 /// \param _json [out] resulting JSON object
@@ -0,0 +1,77 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Helper to run independent tasks concurrently.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace dev
+{
+
+/// Calls @a _task(i) for every i smaller than @a _count on a pool of threads, which includes the
+/// calling thread, and waits for all calls to finish. The order of the calls is unspecified, so
+/// the tasks have to be independent of each other.
+/// If tasks throw, the remaining tasks are still run and the exception of the task with the
+/// smallest index is rethrown, which keeps error reporting deterministic.
+template <class Task>
+void parallelFor(size_t _count, Task const& _task)
+{
+	if (_count == 0)
+		return;
+
+	std::atomic<size_t> nextIndex{0};
+	std::mutex errorMutex;
+	std::exception_ptr error;
+	size_t errorIndex = _count;
+	auto worker = [&]()
+	{
+		for (size_t i = nextIndex++; i < _count; i = nextIndex++)
+			try
+			{
+				_task(i);
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> lock(errorMutex);
+				if (i < errorIndex)
+				{
+					errorIndex = i;
+					error = std::current_exception();
+				}
+			}
+	};
+
+	size_t threadCount = std::min<size_t>(_count, std::max(1u, std::thread::hardware_concurrency()));
+	std::vector<std::thread> threads;
+	for (size_t i = 1; i < threadCount; ++i)
+		threads.emplace_back(worker);
+	worker();
+	for (std::thread& thread: threads)
+		thread.join();
+	if (error)
+		std::rethrow_exception(error);
+}
+
+}
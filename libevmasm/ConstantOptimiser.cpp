@@ -22,6 +22,7 @@
 #include <libevmasm/ConstantOptimiser.h>
 #include <libevmasm/Assembly.h>
 #include <libevmasm/GasMeter.h>
+#include <libevmasm/SemanticInformation.h>
 using namespace std;
 using namespace dev;
 using namespace dev::eth;
@@ -41,17 +42,21 @@ unsigned ConstantOptimisationMethod::optimiseConstants(
 	for (AssemblyItem const& item: _items)
 		if (item.type() == Push)
 			pushes[item]++;
+	Params params;
+	params.isCreation = _isCreation;
+	params.runs = _runs;
+	params.evmVersion = _evmVersion;
 	map<u256, AssemblyItems> pendingReplacements;
+	// Constants that are cheaper to copy via the shared copy routine than by any
+	// other method, and the total amount of gas saved by doing so.
+	set<u256> sharedCopyCandidates;
+	bigint sharedCopySavings = 0;
 	for (auto it: pushes)
 	{
 		AssemblyItem const& item = it.first;
 		if (item.data() < 0x100)
 			continue;
-		Params params;
 		params.multiplicity = it.second;
-		params.isCreation = _isCreation;
-		params.runs = _runs;
-		params.evmVersion = _evmVersion;
 		LiteralMethod lit(params, item.data());
 		bigint literalGas = lit.gasNeeded();
 		CodeCopyMethod copy(params, item.data());
@@ -71,6 +76,44 @@ unsigned ConstantOptimisationMethod::optimiseConstants(
 		}
 		if (!replacement.empty())
 			pendingReplacements[item.data()] = replacement;
+
+		bigint bestGas = min(literalGas, min(copyGas, computeGas));
+		bigint sharedCopyGas = SharedCodeCopyMethod(params, item.data()).gasNeeded();
+		if (sharedCopyGas < bestGas)
+		{
+			sharedCopyCandidates.insert(item.data());
+			sharedCopySavings += bestGas - sharedCopyGas;
+		}
+	}
+	// The shared copy routine is only worth it if the savings across all constants
+	// outweigh the costs of the routine itself.
+	u256 const zero = 0;
+	if (!sharedCopyCandidates.empty() && sharedCopySavings > SharedCodeCopyMethod(params, zero).routineGas())
+	{
+		for (u256 const& value: sharedCopyCandidates)
+			if (pendingReplacements.erase(value) == 0)
+				optimisations++;
+		AssemblyItem routineTag = _assembly.newTag();
+		AssemblyItems replaced;
+		for (AssemblyItem const& item: _items)
+			if (item.type() == Push && sharedCopyCandidates.count(item.data()))
+			{
+				params.multiplicity = pushes.at(item);
+				for (AssemblyItem callSiteItem: SharedCodeCopyMethod(params, item.data()).callSite(_assembly, routineTag))
+				{
+					callSiteItem.setLocation(item.location());
+					replaced.push_back(move(callSiteItem));
+				}
+			}
+			else
+				replaced.push_back(item);
+		if (replaced.empty() || !(
+			replaced.back().type() == Operation &&
+			(SemanticInformation::terminatesControlFlow(replaced.back()) || replaced.back() == Instruction::JUMP)
+		))
+			replaced.push_back(Instruction::STOP);
+		replaced += SharedCodeCopyMethod::copyRoutine(routineTag);
+		_items = move(replaced);
 	}
 	if (!pendingReplacements.empty())
 		replaceConstants(_items, pendingReplacements);
@@ -185,6 +228,89 @@ AssemblyItems const& CodeCopyMethod::copyRoutine()
 	return copyRoutine;
 }
 
+bigint SharedCodeCopyMethod::gasNeeded() const
+{
+	AssemblyItems callSiteItems{
+		AssemblyItem(PushTag, 0),
+		AssemblyItem(PushData, u256(1) << 16),
+		AssemblyItem(PushTag, 0),
+		Instruction::JUMP,
+		AssemblyItem(Tag, 0)
+	};
+	return combineGas(
+		// Run gas: call site plus the shared routine, ignoring memory increase costs
+		3 * GasMeter::runGas(Instruction::PUSH1) +
+			GasMeter::runGas(Instruction::JUMP) +
+			2 * GasMeter::runGas(Instruction::JUMPDEST) +
+			simpleRunGas(copyRoutine(AssemblyItem(Tag, 0))) +
+			GasCosts::copyGas,
+		// Data gas for the call site.
+		bytesRequired(callSiteItems) * (m_params.isCreation ? GasCosts::txDataNonZeroGas(m_params.evmVersion) : GasCosts::createDataGas),
+		// Data gas for data itself
+		dataGas(toBigEndian(m_value))
+	);
+}
+
+AssemblyItems SharedCodeCopyMethod::callSite(Assembly& _assembly, AssemblyItem const& _routineTag) const
+{
+	bytes data = toBigEndian(m_value);
+	assertThrow(data.size() == 32, OptimizerException, "Invalid number encoding.");
+	AssemblyItem returnTag = _assembly.newTag();
+	AssemblyItem jump(Instruction::JUMP);
+	jump.setJumpType(AssemblyItem::JumpType::IntoFunction);
+	return AssemblyItems{
+		returnTag.pushTag(),
+		_assembly.newData(data),
+		_routineTag.pushTag(),
+		jump,
+		returnTag
+	};
+}
+
+bigint SharedCodeCopyMethod::routineGas() const
+{
+	return
+		bytesRequired(copyRoutine(AssemblyItem(Tag, 0))) *
+		(m_params.isCreation ? GasCosts::txDataNonZeroGas(m_params.evmVersion) : GasCosts::createDataGas);
+}
+
+AssemblyItems SharedCodeCopyMethod::copyRoutine(AssemblyItem const& _routineTag)
+{
+	AssemblyItem jump(Instruction::JUMP);
+	jump.setJumpType(AssemblyItem::JumpType::OutOfFunction);
+	return AssemblyItems{
+		_routineTag,
+
+		// constant to be reused 3+ times
+		u256(0),
+
+		// back up memory
+		// mload(0)
+		Instruction::DUP1,
+		Instruction::MLOAD,
+
+		// codecopy(0, <offset>, 32)
+		Instruction::SWAP2,
+		u256(32),
+		Instruction::SWAP1,
+		Instruction::DUP3,
+		Instruction::CODECOPY,
+
+		// mload(0)
+		Instruction::DUP1,
+		Instruction::MLOAD,
+
+		// restore original memory
+		Instruction::SWAP2,
+		Instruction::SWAP1,
+		Instruction::MSTORE,
+
+		// return to the call site
+		Instruction::SWAP1,
+		jump
+	};
+}
+
 AssemblyItems ComputeMethod::findRepresentation(u256 const& _value)
 {
 	if (_value < 0x10000)
@@ -128,6 +128,33 @@ protected:
 	static AssemblyItems const& copyRoutine();
 };
 
+/**
+ * Method that stores the data in the .data section of the code like CodeCopyMethod, but
+ * jumps to a copy routine shared by all constants stored this way instead of inlining
+ * the routine at each occurrence.
+ * Only pays off if the constants are used often enough to amortise the shared routine.
+ */
+class SharedCodeCopyMethod: public ConstantOptimisationMethod
+{
+public:
+	explicit SharedCodeCopyMethod(Params const& _params, u256 const& _value):
+		ConstantOptimisationMethod(_params, _value) {}
+	bigint gasNeeded() const override;
+	/// Every occurrence needs its own return tag, so this does not provide a common
+	/// replacement. Use @a callSite instead.
+	AssemblyItems execute(Assembly&) const override { return AssemblyItems{}; }
+	/// @returns the items that replace a single occurrence of the constant and jump to
+	/// the shared copy routine starting at @a _routineTag.
+	AssemblyItems callSite(Assembly& _assembly, AssemblyItem const& _routineTag) const;
+	/// @returns the gas needed to store the shared copy routine in the code.
+	bigint routineGas() const;
+
+	/// @returns the shared copy routine starting at @a _routineTag.
+	/// Expects the return tag and the code offset of the constant on the stack
+	/// and returns the value of the constant.
+	static AssemblyItems copyRoutine(AssemblyItem const& _routineTag);
+};
+
 /**
  * Method that tries to compute the constant.
  */
@@ -40,6 +40,9 @@ GasMeter::GasConsumption PathGasMeter::estimateMax(
 	shared_ptr<KnownState> const& _state
 )
 {
+	m_queue.clear();
+	m_highestGasUsagePerJumpdest.clear();
+
 	auto path = make_unique<GasPath>();
 	path->index = _startIndex;
 	path->state = _state->copy();
@@ -49,12 +49,17 @@ struct GasPath
  * Computes an upper bound on the gas usage of a computation starting at a certain position in
  * a list of AssemblyItems in a given state until the computation stops.
  * Can be used to estimate the gas usage of functions on any given input.
+ * A single instance can be used for several estimations on the same list of items, so that
+ * the positions of the tags only have to be determined once. Instances are not thread-safe,
+ * but different instances can be used concurrently.
  */
 class PathGasMeter
 {
 public:
 	explicit PathGasMeter(AssemblyItems const& _items, langutil::EVMVersion _evmVersion);
 
+	/// @returns an upper bound on the gas usage of the computation starting at @a _startIndex
+	/// in state @a _state. Does not depend on previous calls.
 	GasMeter::GasConsumption estimateMax(size_t _startIndex, std::shared_ptr<KnownState> const& _state);
 
 	static GasMeter::GasConsumption estimateMax(
@@ -86,6 +86,9 @@ public:
 	bool hasExtCodeHash() const { return *this >= constantinople(); }
 	bool hasChainID() const { return *this >= istanbul(); }
 	bool hasSelfBalance() const { return *this >= istanbul(); }
+	/// Has a native memory-to-memory copy opcode. None of the supported versions has one yet,
+	/// so bulk memory copies go through the identity precompile.
+	bool hasMemoryCopy() const { return false; }
 
 	bool hasOpcode(dev::eth::Instruction _opcode) const;
 
@@ -45,10 +45,9 @@ public:
 
 	ErrorReporter& operator=(ErrorReporter const& _errorReporter);
 
-	void append(ErrorList const& _errorList)
-	{
-		m_errorList += _errorList;
-	}
+	/// Appends the errors of @a _errorList as if they had been reported one after the other,
+	/// i.e. they count towards hasErrors() afterwards and are subject to the same limits.
+	void append(ErrorList const& _errorList);
 
 	void warning(std::string const& _description);
 
@@ -0,0 +1,70 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Helper to run independent checks concurrently while reporting their errors deterministically.
+ */
+
+#pragma once
+
+#include <liblangutil/ErrorReporter.h>
+#include <liblangutil/Exceptions.h>
+
+#include <libdevcore/Parallel.h>
+
+#include <vector>
+
+namespace langutil
+{
+
+/// Calls @a _check(i, errorReporter) for every i smaller than @a _count concurrently, each call
+/// with an error reporter of its own. Afterwards, the reported errors are appended to
+/// @a _errorReporter in the order of the indices, as if the calls had been made one after the other.
+/// If a call throws a FatalError, it is rethrown once the errors up to and including the ones of
+/// that call have been appended.
+/// @returns true if all calls returned true.
+template <class Check>
+bool reportConcurrently(size_t _count, ErrorReporter& _errorReporter, Check const& _check)
+{
+	std::vector<ErrorList> errors(_count);
+	// Not std::vector<bool>, whose elements cannot be written concurrently.
+	std::vector<char> results(_count, false);
+	std::vector<char> aborted(_count, false);
+	dev::parallelFor(_count, [&](size_t _index) {
+		ErrorReporter errorReporter(errors[_index]);
+		try
+		{
+			results[_index] = _check(_index, errorReporter);
+		}
+		catch (FatalError const&)
+		{
+			aborted[_index] = true;
+		}
+	});
+
+	bool success = true;
+	for (size_t i = 0; i < _count; ++i)
+	{
+		_errorReporter.append(errors[i]);
+		if (aborted[i])
+			BOOST_THROW_EXCEPTION(FatalError());
+		if (!results[i])
+			success = false;
+	}
+	return success;
+}
+
+}
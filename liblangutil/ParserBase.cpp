@@ -47,7 +47,7 @@ Token ParserBase::peekNextToken() const
 	return m_scanner->peekNextToken();
 }
 
-string ParserBase::currentLiteral() const
+string_view ParserBase::currentLiteral() const
 {
 	return m_scanner->currentLiteral();
 }
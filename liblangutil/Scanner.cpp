@@ -97,7 +97,7 @@ namespace langutil
 enum LiteralType
 {
 	LITERAL_TYPE_STRING,
-	LITERAL_TYPE_NUMBER, // not really different from string type in behaviour
+	LITERAL_TYPE_SOURCE, // identifiers and numbers, the literal is the source text of the token
 	LITERAL_TYPE_COMMENT
 };
 
@@ -112,7 +112,10 @@ public:
 		if (_type == LITERAL_TYPE_COMMENT)
 			m_scanner->m_nextSkippedComment.literal.clear();
 		else
+		{
 			m_scanner->m_nextToken.literal.clear();
+			m_scanner->m_nextToken.literalInSource = false;
+		}
 	}
 	~LiteralScope()
 	{
@@ -124,7 +127,12 @@ public:
 				m_scanner->m_nextToken.literal.clear();
 		}
 	}
-	void complete() { m_complete = true; }
+	void complete()
+	{
+		m_complete = true;
+		if (m_type == LITERAL_TYPE_SOURCE)
+			m_scanner->m_nextToken.literalInSource = true;
+	}
 
 private:
 	enum LiteralType m_type;
@@ -473,6 +481,7 @@ void Scanner::scanToken()
 {
 	m_nextToken.error = ScannerError::NoError;
 	m_nextToken.literal.clear();
+	m_nextToken.literalInSource = false;
 	m_nextToken.extendedTokenInfo = make_tuple(0, 0);
 	m_nextSkippedComment.literal.clear();
 	m_nextSkippedComment.extendedTokenInfo = make_tuple(0, 0);
@@ -822,7 +831,7 @@ void Scanner::scanDecimalDigits()
 
 	// May continue with decimal digit or underscore for grouping.
 	do
-		addLiteralCharAndAdvance();
+		advance();
 	while (!m_source->isPastEndOfInput() && (isDecimalDigit(m_char) || m_char == '_'));
 
 	// Defer further validation of underscore to SyntaxChecker.
@@ -831,11 +840,10 @@ void Scanner::scanDecimalDigits()
 Token Scanner::scanNumber(char _charSeen)
 {
 	enum { DECIMAL, HEX, BINARY } kind = DECIMAL;
-	LiteralScope literal(this, LITERAL_TYPE_NUMBER);
+	LiteralScope literal(this, LITERAL_TYPE_SOURCE);
 	if (_charSeen == '.')
 	{
 		// we have already seen a decimal point of the float
-		addLiteralChar('.');
 		if (m_char == '_')
 			return setError(ScannerError::IllegalToken);
 		scanDecimalDigits();  // we know we have at least one digit
@@ -846,18 +854,18 @@ Token Scanner::scanNumber(char _charSeen)
 		// if the first character is '0' we must check for octals and hex
 		if (m_char == '0')
 		{
-			addLiteralCharAndAdvance();
+			advance();
 			// either 0, 0exxx, 0Exxx, 0.xxx or a hex number
 			if (m_char == 'x')
 			{
 				// hex number
 				kind = HEX;
-				addLiteralCharAndAdvance();
+				advance();
 				if (!isHexDigit(m_char))
 					return setError(ScannerError::IllegalHexDigit); // we must have at least one hex digit after 'x'
 
 				while (isHexDigit(m_char) || m_char == '_') // We keep the underscores for later validation
-					addLiteralCharAndAdvance();
+					advance();
 			}
 			else if (isDecimalDigit(m_char))
 				// We do not allow octal numbers
@@ -873,8 +881,8 @@ Token Scanner::scanNumber(char _charSeen)
 				{
 					// Assume the input may be a floating point number with leading '_' in fraction part.
 					// Recover by consuming it all but returning `Illegal` right away.
-					addLiteralCharAndAdvance(); // '.'
-					addLiteralCharAndAdvance(); // '_'
+					advance(); // '.'
+					advance(); // '_'
 					scanDecimalDigits();
 				}
 				if (m_source->isPastEndOfInput() || !isDecimalDigit(m_source->get(1)))
@@ -883,7 +891,7 @@ Token Scanner::scanNumber(char _charSeen)
 					literal.complete();
 					return Token::Number;
 				}
-				addLiteralCharAndAdvance();
+				advance();
 				scanDecimalDigits();
 			}
 		}
@@ -898,16 +906,16 @@ Token Scanner::scanNumber(char _charSeen)
 		{
 			// Recover from wrongly placed underscore as delimiter in literal with scientific
 			// notation by consuming until the end.
-			addLiteralCharAndAdvance(); // 'e'
-			addLiteralCharAndAdvance(); // '_'
+			advance(); // 'e'
+			advance(); // '_'
 			scanDecimalDigits();
 			literal.complete();
 			return Token::Number;
 		}
 		// scan exponent
-		addLiteralCharAndAdvance(); // 'e' | 'E'
+		advance(); // 'e' | 'E'
 		if (m_char == '+' || m_char == '-')
-			addLiteralCharAndAdvance();
+			advance();
 		if (!isDecimalDigit(m_char)) // we must have at least one decimal digit after 'e'/'E'
 			return setError(ScannerError::IllegalExponent);
 		scanDecimalDigits();
@@ -925,11 +933,14 @@ Token Scanner::scanNumber(char _charSeen)
 tuple<Token, unsigned, unsigned> Scanner::scanIdentifierOrKeyword()
 {
 	solAssert(isIdentifierStart(m_char), "");
-	LiteralScope literal(this, LITERAL_TYPE_STRING);
-	addLiteralCharAndAdvance();
+	LiteralScope literal(this, LITERAL_TYPE_SOURCE);
+	size_t start = static_cast<size_t>(sourcePos());
+	advance();
 	// Scan the rest of the identifier characters.
 	while (isIdentifierPart(m_char) || (m_char == '.' && m_supportPeriodInIdentifier))
-		addLiteralCharAndAdvance();
+		advance();
 	literal.complete();
-	return TokenTraits::fromIdentifierOrKeyword(m_nextToken.literal);
+	return TokenTraits::fromIdentifierOrKeyword(
+		string_view(source()).substr(start, static_cast<size_t>(sourcePos()) - start)
+	);
 }
@@ -60,6 +60,7 @@
 
 #include <optional>
 #include <iosfwd>
+#include <string_view>
 
 namespace langutil
 {
@@ -132,7 +133,9 @@ public:
 	}
 
 	SourceLocation currentLocation() const { return m_currentToken.location; }
-	std::string const& currentLiteral() const { return m_currentToken.literal; }
+	/// @returns the literal of the current token. Identifiers and numbers refer to the source
+	/// without copying it. The result is only valid until the scanner advances.
+	std::string_view currentLiteral() const { return literal(m_currentToken); }
 	std::tuple<unsigned, unsigned> const& currentTokenInfo() const { return m_currentToken.extendedTokenInfo; }
 
 	/// Retrieves the last error that occurred during lexical analysis.
@@ -156,7 +159,7 @@ public:
 	/// @returns the next token without advancing input.
 	Token peekNextToken() const { return m_nextToken.token; }
 	SourceLocation peekLocation() const { return m_nextToken.location; }
-	std::string const& peekLiteral() const { return m_nextToken.literal; }
+	std::string_view peekLiteral() const { return literal(m_nextToken); }
 	///@}
 
 	///@{
@@ -185,16 +188,30 @@ private:
 	{
 		Token token;
 		SourceLocation location;
+		/// The decoded literal, unless it is a part of the source, see below.
 		std::string literal;
+		/// True if the literal is the source text of the token, which is the case for
+		/// identifiers, keywords and numbers. Then, @a literal is empty.
+		bool literalInSource = false;
 		ScannerError error = ScannerError::NoError;
 		std::tuple<unsigned, unsigned> extendedTokenInfo;
 	};
 
+	/// @returns the literal of the given token.
+	std::string_view literal(TokenDesc const& _token) const
+	{
+		if (_token.literalInSource)
+			return std::string_view(m_source->source()).substr(
+				static_cast<size_t>(_token.location.start),
+				static_cast<size_t>(_token.location.end - _token.location.start)
+			);
+		return _token.literal;
+	}
+
 	///@{
 	///@name Literal buffer support
 	inline void addLiteralChar(char c) { m_nextToken.literal.push_back(c); }
 	inline void addCommentLiteralChar(char c) { m_nextSkippedComment.literal.push_back(c); }
-	inline void addLiteralCharAndAdvance() { addLiteralChar(m_char); advance(); }
 	void addUnicodeAsUTF8(unsigned codepoint);
 	///@}
 
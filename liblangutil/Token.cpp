@@ -127,7 +127,7 @@ int precedence(Token tok)
 }
 #undef T
 
-int parseSize(string::const_iterator _begin, string::const_iterator _end)
+int parseSize(string_view::const_iterator _begin, string_view::const_iterator _end)
 {
 	try
 	{
@@ -140,25 +140,25 @@ int parseSize(string::const_iterator _begin, string::const_iterator _end)
 	}
 }
 
-static Token keywordByName(string const& _name)
+static Token keywordByName(string_view _name)
 {
 	// The following macros are used inside TOKEN_LIST and cause non-keyword tokens to be ignored
 	// and keywords to be put inside the keywords variable.
 #define KEYWORD(name, string, precedence) {string, Token::name},
 #define TOKEN(name, string, precedence)
-	static map<string, Token> const keywords({TOKEN_LIST(TOKEN, KEYWORD)});
+	static map<string, Token, less<>> const keywords({TOKEN_LIST(TOKEN, KEYWORD)});
 #undef KEYWORD
 #undef TOKEN
 	auto it = keywords.find(_name);
 	return it == keywords.end() ? Token::Identifier : it->second;
 }
 
-tuple<Token, unsigned int, unsigned int> fromIdentifierOrKeyword(string const& _literal)
+tuple<Token, unsigned int, unsigned int> fromIdentifierOrKeyword(string_view _literal)
 {
 	auto positionM = find_if(_literal.begin(), _literal.end(), ::isdigit);
 	if (positionM != _literal.end())
 	{
-		string baseType(_literal.begin(), positionM);
+		string_view baseType = _literal.substr(0, static_cast<size_t>(positionM - _literal.begin()));
 		auto positionX = find_if_not(positionM, _literal.end(), ::isdigit);
 		int m = parseSize(positionM, positionX);
 		Token keyword = keywordByName(baseType);
@@ -48,6 +48,7 @@
 
 #include <iosfwd>
 #include <string>
+#include <string_view>
 #include <tuple>
 
 namespace langutil
@@ -326,7 +327,7 @@ namespace TokenTraits
 	// operators; returns 0 otherwise.
 	int precedence(Token tok);
 
-	std::tuple<Token, unsigned int, unsigned int> fromIdentifierOrKeyword(std::string const& _literal);
+	std::tuple<Token, unsigned int, unsigned int> fromIdentifierOrKeyword(std::string_view _literal);
 
 	// @returns a string corresponding to the C++ token name
 	// (e.g. "LT" for the token LT).
@@ -35,10 +35,10 @@ namespace dev
 namespace solidity
 {
 
-inline vector<shared_ptr<MagicVariableDeclaration const>> constructMagicVariables()
+inline vector<shared_ptr<MagicVariableDeclaration const>> constructMagicVariables(IDDispenser& _nodeIDs)
 {
-	static auto const magicVarDecl = [](string const& _name, Type const* _type) {
-		return make_shared<MagicVariableDeclaration>(_name, _type);
+	auto const magicVarDecl = [&](string const& _name, Type const* _type) {
+		return make_shared<MagicVariableDeclaration>(_nodeIDs.next(), _name, _type);
 	};
 
 	return {
@@ -78,7 +78,9 @@ inline vector<shared_ptr<MagicVariableDeclaration const>> constructMagicVariable
 	};
 }
 
-GlobalContext::GlobalContext(): m_magicVariables{constructMagicVariables()}
+GlobalContext::GlobalContext(IDDispenser& _nodeIDs):
+	m_nodeIDs(_nodeIDs),
+	m_magicVariables{constructMagicVariables(_nodeIDs)}
 {
 }
 
@@ -99,7 +101,7 @@ vector<Declaration const*> GlobalContext::declarations() const
 MagicVariableDeclaration const* GlobalContext::currentThis() const
 {
 	if (!m_thisPointer[m_currentContract])
-		m_thisPointer[m_currentContract] = make_shared<MagicVariableDeclaration>("this", TypeProvider::contract(*m_currentContract));
+		m_thisPointer[m_currentContract] = make_shared<MagicVariableDeclaration>(m_nodeIDs.next(), "this", TypeProvider::contract(*m_currentContract));
 	return m_thisPointer[m_currentContract].get();
 
 }
@@ -107,7 +109,7 @@ MagicVariableDeclaration const* GlobalContext::currentThis() const
 MagicVariableDeclaration const* GlobalContext::currentSuper() const
 {
 	if (!m_superPointer[m_currentContract])
-		m_superPointer[m_currentContract] = make_shared<MagicVariableDeclaration>("super", TypeProvider::contract(*m_currentContract, true));
+		m_superPointer[m_currentContract] = make_shared<MagicVariableDeclaration>(m_nodeIDs.next(), "super", TypeProvider::contract(*m_currentContract, true));
 	return m_superPointer[m_currentContract].get();
 }
 
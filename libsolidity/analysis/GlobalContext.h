@@ -35,6 +35,7 @@ namespace solidity
 {
 
 class Type; // forward
+class IDDispenser;
 
 /**
  * Container for all global objects which look like AST nodes, but are not part of the AST
@@ -45,7 +46,8 @@ class Type; // forward
 class GlobalContext: private boost::noncopyable
 {
 public:
-	GlobalContext();
+	/// @param _nodeIDs source of the IDs of the magic variables, has to outlive the global context.
+	explicit GlobalContext(IDDispenser& _nodeIDs);
 	void setCurrentContract(ContractDefinition const& _contract);
 	MagicVariableDeclaration const* currentThis() const;
 	MagicVariableDeclaration const* currentSuper() const;
@@ -54,6 +56,7 @@ public:
 	std::vector<Declaration const*> declarations() const;
 
 private:
+	IDDispenser& m_nodeIDs;
 	std::vector<std::shared_ptr<MagicVariableDeclaration const>> m_magicVariables;
 	ContractDefinition const* m_currentContract = nullptr;
 	std::map<ContractDefinition const*, std::shared_ptr<MagicVariableDeclaration const>> mutable m_thisPointer;
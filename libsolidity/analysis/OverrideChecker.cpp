@@ -440,8 +440,9 @@ void OverrideChecker::check(ContractDefinition const& _contract)
 
 void OverrideChecker::checkIllegalOverrides(ContractDefinition const& _contract)
 {
-	OverrideProxyBySignatureMultiSet const& inheritedFuncs = inheritedFunctions(_contract);
-	OverrideProxyBySignatureMultiSet const& inheritedMods = inheritedModifiers(_contract);
+	InheritanceSummary const& summary = InheritanceSummary::of(_contract);
+	OverrideProxyBySignatureMultiSet const& inheritedFuncs = summary.inheritedFunctions();
+	OverrideProxyBySignatureMultiSet const& inheritedMods = summary.inheritedModifiers();
 
 	for (ModifierDefinition const* modifier: _contract.functionModifiers())
 	{
@@ -614,7 +615,7 @@ void OverrideChecker::checkAmbiguousOverrides(ContractDefinition const& _contrac
 		// Fetch inherited functions and sort them by signature.
 		// We get at least one function per signature and direct base contract, which is
 		// enough because we re-construct the inheritance graph later.
-		OverrideProxyBySignatureMultiSet nonOverriddenFunctions = inheritedFunctions(_contract);
+		OverrideProxyBySignatureMultiSet nonOverriddenFunctions = InheritanceSummary::of(_contract).inheritedFunctions();
 
 		// Remove all functions that match the signature of a function in the current contract.
 		for (FunctionDefinition const* f: _contract.definedFunctions())
@@ -635,7 +636,7 @@ void OverrideChecker::checkAmbiguousOverrides(ContractDefinition const& _contrac
 	}
 
 	{
-		OverrideProxyBySignatureMultiSet modifiers = inheritedModifiers(_contract);
+		OverrideProxyBySignatureMultiSet modifiers = InheritanceSummary::of(_contract).inheritedModifiers();
 		for (ModifierDefinition const* mod: _contract.functionModifiers())
 			modifiers.erase(OverrideProxy{mod});
 
@@ -662,15 +663,8 @@ void OverrideChecker::checkAmbiguousOverridesInternal(set<OverrideProxy> _baseCa
 	// Remove all base functions overridden by cut vertices (they don't need to be overridden).
 	for (OverrideProxy const& function: cutVertexFinder.cutVertices())
 	{
-		std::set<OverrideProxy> toTraverse = function.baseFunctions();
-		while (!toTraverse.empty())
-		{
-			OverrideProxy base = *toTraverse.begin();
-			toTraverse.erase(toTraverse.begin());
+		for (OverrideProxy const& base: InheritanceSummary::of(function.contract()).baseFunctionClosure(function))
 			_baseCallables.erase(base);
-			for (OverrideProxy const& f: base.baseFunctions())
-				toTraverse.insert(f);
-		}
 		// Remove unimplemented base functions at the cut vertices itself as well.
 		if (function.unimplemented())
 			_baseCallables.erase(function);
@@ -804,54 +798,81 @@ void OverrideChecker::checkOverrideList(OverrideProxy _item, OverrideProxyBySign
 		);
 }
 
-OverrideChecker::OverrideProxyBySignatureMultiSet const& OverrideChecker::inheritedFunctions(ContractDefinition const& _contract) const
+InheritanceSummary const& InheritanceSummary::of(ContractDefinition const& _contract)
+{
+	shared_ptr<InheritanceSummary>& summary = _contract.annotation().inheritanceSummary;
+	if (!summary)
+		summary.reset(new InheritanceSummary(_contract));
+	return *summary;
+}
+
+InheritanceSummary::InheritanceSummary(ContractDefinition const& _contract):
+	m_contract(_contract)
 {
-	if (!m_inheritedFunctions.count(&_contract))
+	for (auto const* base: resolveDirectBaseContracts(_contract))
 	{
-		OverrideProxyBySignatureMultiSet result;
+		InheritanceSummary const& baseSummary = of(*base);
+
+		set<OverrideProxy, OverrideProxy::CompareBySignature> functionsInBase;
+		for (FunctionDefinition const* fun: base->definedFunctions())
+			if (!fun->isConstructor())
+				functionsInBase.emplace(OverrideProxy{fun});
+		for (VariableDeclaration const* var: base->stateVariables())
+			if (var->isPublic())
+				functionsInBase.emplace(OverrideProxy{var});
+		for (OverrideProxy const& func: baseSummary.inheritedFunctions())
+			functionsInBase.insert(func);
+		m_inheritedFunctions += functionsInBase;
+
+		set<OverrideProxy, OverrideProxy::CompareBySignature> modifiersInBase;
+		for (ModifierDefinition const* mod: base->functionModifiers())
+			modifiersInBase.emplace(OverrideProxy{mod});
+		for (OverrideProxy const& mod: baseSummary.inheritedModifiers())
+			modifiersInBase.insert(mod);
+		m_inheritedModifiers += modifiersInBase;
+	}
 
-		for (auto const* base: resolveDirectBaseContracts(_contract))
-		{
-			set<OverrideProxy, OverrideProxy::CompareBySignature> functionsInBase;
-			for (FunctionDefinition const* fun: base->definedFunctions())
-				if (!fun->isConstructor())
-					functionsInBase.emplace(OverrideProxy{fun});
-			for (VariableDeclaration const* var: base->stateVariables())
-				if (var->isPublic())
-					functionsInBase.emplace(OverrideProxy{var});
-
-			for (OverrideProxy const& func: inheritedFunctions(*base))
-				functionsInBase.insert(func);
-
-			result += functionsInBase;
-		}
+	vector<ContractDefinition const*> const& bases = _contract.annotation().linearizedBaseContracts;
+	for (size_t i = 0; i < bases.size(); ++i)
+		m_basePositions[bases[i]] = i;
+}
 
-		m_inheritedFunctions[&_contract] = result;
+size_t InheritanceSummary::basePosition(ContractDefinition const& _base) const
+{
+	auto it = m_basePositions.find(&_base);
+	solAssert(it != m_basePositions.end(), "Base not found in inheritance hierarchy.");
+	return it->second;
+}
+
+vector<FunctionDefinition const*> const& InheritanceSummary::implementations(FunctionDefinition const& _function) const
+{
+	if (!m_implementationsCollected)
+	{
+		for (ContractDefinition const* base: m_contract.annotation().linearizedBaseContracts)
+			for (FunctionDefinition const* function: base->definedFunctions())
+				if (!function->isConstructor())
+					m_implementations[OverrideProxy{function}].push_back(function);
+		m_implementationsCollected = true;
 	}
 
-	return m_inheritedFunctions[&_contract];
+	auto it = m_implementations.find(OverrideProxy{&_function});
+	solAssert(it != m_implementations.end(), "Function " + _function.name() + " not found in inheritance hierarchy.");
+	return it->second;
 }
 
-OverrideChecker::OverrideProxyBySignatureMultiSet const& OverrideChecker::inheritedModifiers(ContractDefinition const& _contract) const
+set<OverrideProxy> const& InheritanceSummary::baseFunctionClosure(OverrideProxy const& _item) const
 {
-	if (!m_inheritedModifiers.count(&_contract))
+	solAssert(&_item.contract() == &m_contract, "");
+	auto it = m_baseFunctionClosures.find(_item);
+	if (it == m_baseFunctionClosures.end())
 	{
-		OverrideProxyBySignatureMultiSet result;
-
-		for (auto const* base: resolveDirectBaseContracts(_contract))
+		set<OverrideProxy> closure;
+		for (OverrideProxy const& base: _item.baseFunctions())
 		{
-			set<OverrideProxy, OverrideProxy::CompareBySignature> modifiersInBase;
-			for (ModifierDefinition const* mod: base->functionModifiers())
-				modifiersInBase.emplace(OverrideProxy{mod});
-
-			for (OverrideProxy const& mod: inheritedModifiers(*base))
-				modifiersInBase.insert(mod);
-
-			result += modifiersInBase;
+			closure.insert(base);
+			closure += of(base.contract()).baseFunctionClosure(base);
 		}
-
-		m_inheritedModifiers[&_contract] = result;
+		it = m_baseFunctionClosures.emplace(_item, move(closure)).first;
 	}
-
-	return m_inheritedModifiers[&_contract];
+	return it->second;
 }
@@ -26,6 +26,7 @@
 #include <map>
 #include <functional>
 #include <set>
+#include <vector>
 #include <variant>
 #include <optional>
 
@@ -124,6 +125,51 @@ private:
 	std::shared_ptr<OverrideComparator> mutable m_comparator;
 };
 
+using OverrideProxyBySignatureMultiSet = std::multiset<OverrideProxy, OverrideProxy::CompareBySignature>;
+
+/**
+ * Summary of the functions, public state variables and modifiers a contract inherits.
+ * It is computed once per contract, stored in the annotation of the contract and shared by the
+ * override checks and the code generator. The summaries of the base contracts are used to
+ * compute the summary of a derived contract.
+ */
+class InheritanceSummary
+{
+public:
+	/// @returns the summary of @a _contract, which is created on first use.
+	static InheritanceSummary const& of(ContractDefinition const& _contract);
+
+	/// @returns all functions of bases (including public state variables) that have not yet been overwritten.
+	/// May contain the same function multiple times when used with shared bases.
+	OverrideProxyBySignatureMultiSet const& inheritedFunctions() const { return m_inheritedFunctions; }
+	OverrideProxyBySignatureMultiSet const& inheritedModifiers() const { return m_inheritedModifiers; }
+
+	/// @returns the position of @a _base in the linearized base contracts, where the
+	/// contract itself is at position zero.
+	size_t basePosition(ContractDefinition const& _base) const;
+	/// @returns the functions with the same name and parameter types as @a _function that are
+	/// defined in the contract or its bases, ordered like the linearized base contracts.
+	std::vector<FunctionDefinition const*> const& implementations(FunctionDefinition const& _function) const;
+
+	/// @returns the functions or modifiers @a _item overrides, directly or indirectly.
+	/// @a _item has to be defined in this contract and its overrides have to be checked already.
+	std::set<OverrideProxy> const& baseFunctionClosure(OverrideProxy const& _item) const;
+
+private:
+	explicit InheritanceSummary(ContractDefinition const& _contract);
+
+	ContractDefinition const& m_contract;
+	OverrideProxyBySignatureMultiSet m_inheritedFunctions;
+	OverrideProxyBySignatureMultiSet m_inheritedModifiers;
+	std::map<ContractDefinition const*, size_t> m_basePositions;
+
+	/// Cache for implementations(), filled on first use.
+	std::map<OverrideProxy, std::vector<FunctionDefinition const*>, OverrideProxy::CompareBySignature> mutable m_implementations;
+	bool mutable m_implementationsCollected = false;
+	/// Cache for baseFunctionClosure().
+	std::map<OverrideProxy, std::set<OverrideProxy>> mutable m_baseFunctionClosures;
+};
+
 
 /**
  * Component that verifies override properties.
@@ -176,20 +222,9 @@ private:
 	/// Resolves an override list of UserDefinedTypeNames to a list of contracts.
 	std::set<ContractDefinition const*, CompareByID> resolveOverrideList(OverrideSpecifier const& _overrides) const;
 
-	using OverrideProxyBySignatureMultiSet = std::multiset<OverrideProxy, OverrideProxy::CompareBySignature>;
-
 	void checkOverrideList(OverrideProxy _item, OverrideProxyBySignatureMultiSet const& _inherited);
 
-	/// Returns all functions of bases (including public state variables) that have not yet been overwritten.
-	/// May contain the same function multiple times when used with shared bases.
-	OverrideProxyBySignatureMultiSet const& inheritedFunctions(ContractDefinition const& _contract) const;
-	OverrideProxyBySignatureMultiSet const& inheritedModifiers(ContractDefinition const& _contract) const;
-
 	langutil::ErrorReporter& m_errorReporter;
-
-	/// Cache for inheritedFunctions().
-	std::map<ContractDefinition const*, OverrideProxyBySignatureMultiSet> mutable m_inheritedFunctions;
-	std::map<ContractDefinition const*, OverrideProxyBySignatureMultiSet> mutable m_inheritedModifiers;
 };
 
 }
@@ -344,8 +344,10 @@ bigint StaticAnalyzer::structureSizeEstimate(Type const& _type, set<StructDefini
 		if (!_structsSeen.count(&t.structDefinition()))
 		{
 			_structsSeen.insert(&t.structDefinition());
-			for (auto const& m: t.members(nullptr))
-				size += structureSizeEstimate(*m.type, _structsSeen);
+			// The member types are taken from the declarations instead of from t.members(),
+			// which fills a cache of the type and is thus not safe to call concurrently.
+			for (auto const& member: t.structDefinition().members())
+				size += structureSizeEstimate(*member->annotation().type, _structsSeen);
 		}
 		return size;
 	}
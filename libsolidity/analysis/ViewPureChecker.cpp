@@ -20,6 +20,7 @@
 #include <libyul/AsmData.h>
 #include <libyul/backends/evm/EVMDialect.h>
 #include <liblangutil/ErrorReporter.h>
+#include <liblangutil/ParallelReporting.h>
 #include <libevmasm/SemanticInformation.h>
 
 #include <functional>
@@ -144,10 +145,16 @@ bool ViewPureChecker::check()
 		for (ModifierDefinition const* mod: contract->functionModifiers())
 			mod->accept(*this);
 
-	for (auto const& contract: contracts)
-		contract->accept(*this);
+	// The modifiers are known now, so the contracts can be checked independently of each other.
+	// Every contract is checked by a checker of its own that reports to its own error reporter.
+	bool success = reportConcurrently(contracts.size(), m_errorReporter, [&](size_t _index, ErrorReporter& _errorReporter) {
+		ViewPureChecker checker(m_ast, _errorReporter);
+		checker.m_inferredMutability = m_inferredMutability;
+		contracts[_index]->accept(checker);
+		return !checker.m_errors;
+	});
 
-	return !m_errors;
+	return success && !m_errors;
 }
 
 
@@ -23,6 +23,7 @@
 #pragma once
 
 #include <libsolidity/ast/ASTForward.h>
+#include <libsolidity/ast/ASTArena.h>
 #include <libsolidity/ast/Types.h>
 #include <libsolidity/ast/ASTAnnotations.h>
 #include <libsolidity/ast/ASTEnums.h>
@@ -66,13 +67,11 @@ class ASTNode: private boost::noncopyable
 public:
 	using SourceLocation = langutil::SourceLocation;
 
-	explicit ASTNode(SourceLocation const& _location);
-	virtual ~ASTNode() {}
+	explicit ASTNode(size_t _id, SourceLocation const& _location);
+	virtual ~ASTNode();
 
 	/// @returns an identifier of this AST node that is unique for a single compilation run.
 	size_t id() const { return m_id; }
-	/// Resets the global ID counter. This invalidates all previous IDs.
-	static void resetID();
 
 	virtual void accept(ASTVisitor& _visitor) = 0;
 	virtual void accept(ASTConstVisitor& _visitor) const = 0;
@@ -100,6 +99,10 @@ public:
 
 	///@todo make this const-safe by providing a different way to access the annotation
 	virtual ASTAnnotation& annotation() const;
+	/// Creates the annotation of this node in @a _arena, so that it is placed next to the node.
+	/// Has to be called before the annotation is accessed for the first time and
+	/// @a _arena has to outlive this node.
+	void createAnnotationIn(ASTArena& _arena);
 
 	///@{
 	///@name equality operators
@@ -109,11 +112,25 @@ public:
 	///@}
 
 protected:
-	size_t const m_id = 0;
+	/// Creates the annotation as an instance of @a T if it does not exist yet and returns it.
+	template <class T>
+	T& initAnnotation() const
+	{
+		if (!m_annotation)
+			m_annotation = m_arena ? new (m_arena->allocate(sizeof(T), alignof(T))) T() : new T();
+		return dynamic_cast<T&>(*m_annotation);
+	}
+
+	size_t m_id = 0;
 	/// Annotation - is specialised in derived classes, is created upon request (because of polymorphism).
-	mutable std::unique_ptr<ASTAnnotation> m_annotation;
+	/// Owned by the node, but its memory belongs to m_arena if that is set.
+	mutable ASTAnnotation* m_annotation = nullptr;
+	ASTArena* m_arena = nullptr;
 
 private:
+	/// The parser shifts the IDs of the nodes of sources parsed independently.
+	friend class Parser;
+
 	SourceLocation m_location;
 };
 
@@ -133,8 +150,8 @@ std::vector<_T const*> ASTNode::filteredNodes(std::vector<ASTPointer<ASTNode>> c
 class SourceUnit: public ASTNode
 {
 public:
-	SourceUnit(SourceLocation const& _location, std::vector<ASTPointer<ASTNode>> const& _nodes):
-		ASTNode(_location), m_nodes(_nodes) {}
+	SourceUnit(size_t _id, SourceLocation const& _location, std::vector<ASTPointer<ASTNode>> const& _nodes):
+		ASTNode(_id, _location), m_nodes(_nodes) {}
 
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
@@ -202,11 +219,12 @@ public:
 	}
 
 	Declaration(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<ASTString> const& _name,
 		Visibility _visibility = Visibility::Default
 	):
-		ASTNode(_location), m_name(_name), m_visibility(_visibility) {}
+		ASTNode(_id, _location), m_name(_name), m_visibility(_visibility) {}
 
 	/// @returns the declared name.
 	ASTString const& name() const { return *m_name; }
@@ -247,10 +265,11 @@ class PragmaDirective: public ASTNode
 {
 public:
 	PragmaDirective(
+		size_t _id,
 		SourceLocation const& _location,
 		std::vector<Token> const& _tokens,
 		std::vector<ASTString> const& _literals
-	): ASTNode(_location), m_tokens(_tokens), m_literals(_literals)
+	): ASTNode(_id, _location), m_tokens(_tokens), m_literals(_literals)
 	{}
 
 	void accept(ASTVisitor& _visitor) override;
@@ -289,12 +308,13 @@ public:
 	using SymbolAliasList = std::vector<SymbolAlias>;
 
 	ImportDirective(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<ASTString> const& _path,
 		ASTPointer<ASTString> const& _unitAlias,
 		SymbolAliasList _symbolAliases
 	):
-		Declaration(_location, _unitAlias),
+		Declaration(_id, _location, _unitAlias),
 		m_path(_path),
 		m_symbolAliases(move(_symbolAliases))
 	{ }
@@ -381,6 +401,7 @@ public:
 	enum class ContractKind { Interface, Contract, Library };
 
 	ContractDefinition(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<ASTString> const& _name,
 		ASTPointer<ASTString> const& _documentation,
@@ -389,7 +410,7 @@ public:
 		ContractKind _contractKind = ContractKind::Contract,
 		bool _abstract = false
 	):
-		Declaration(_location, _name),
+		Declaration(_id, _location, _name),
 		Documented(_documentation),
 		m_baseContracts(_baseContracts),
 		m_subNodes(_subNodes),
@@ -461,11 +482,12 @@ class InheritanceSpecifier: public ASTNode
 {
 public:
 	InheritanceSpecifier(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<UserDefinedTypeName> const& _baseName,
 		std::unique_ptr<std::vector<ASTPointer<Expression>>> _arguments
 	):
-		ASTNode(_location), m_baseName(_baseName), m_arguments(std::move(_arguments)) {}
+		ASTNode(_id, _location), m_baseName(_baseName), m_arguments(std::move(_arguments)) {}
 
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
@@ -490,11 +512,12 @@ class UsingForDirective: public ASTNode
 {
 public:
 	UsingForDirective(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<UserDefinedTypeName> const& _libraryName,
 		ASTPointer<TypeName> const& _typeName
 	):
-		ASTNode(_location), m_libraryName(_libraryName), m_typeName(_typeName) {}
+		ASTNode(_id, _location), m_libraryName(_libraryName), m_typeName(_typeName) {}
 
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
@@ -512,11 +535,12 @@ class StructDefinition: public Declaration
 {
 public:
 	StructDefinition(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<ASTString> const& _name,
 		std::vector<ASTPointer<VariableDeclaration>> const& _members
 	):
-		Declaration(_location, _name), m_members(_members) {}
+		Declaration(_id, _location, _name), m_members(_members) {}
 
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
@@ -535,11 +559,12 @@ class EnumDefinition: public Declaration
 {
 public:
 	EnumDefinition(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<ASTString> const& _name,
 		std::vector<ASTPointer<EnumValue>> const& _members
 	):
-		Declaration(_location, _name), m_members(_members) {}
+		Declaration(_id, _location, _name), m_members(_members) {}
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
 
@@ -559,8 +584,8 @@ private:
 class EnumValue: public Declaration
 {
 public:
-	EnumValue(SourceLocation const& _location, ASTPointer<ASTString> const& _name):
-		Declaration(_location, _name) {}
+	EnumValue(size_t _id, SourceLocation const& _location, ASTPointer<ASTString> const& _name):
+		Declaration(_id, _location, _name) {}
 
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
@@ -577,10 +602,11 @@ class ParameterList: public ASTNode
 {
 public:
 	ParameterList(
+		size_t _id,
 		SourceLocation const& _location,
 		std::vector<ASTPointer<VariableDeclaration>> const& _parameters
 	):
-		ASTNode(_location), m_parameters(_parameters) {}
+		ASTNode(_id, _location), m_parameters(_parameters) {}
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
 
@@ -598,6 +624,7 @@ class CallableDeclaration: public Declaration, public VariableScope
 {
 public:
 	CallableDeclaration(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<ASTString> const& _name,
 		Visibility _visibility,
@@ -606,7 +633,7 @@ public:
 		ASTPointer<OverrideSpecifier> const& _overrides = nullptr,
 		ASTPointer<ParameterList> const& _returnParameters = ASTPointer<ParameterList>()
 	):
-		Declaration(_location, _name, _visibility),
+		Declaration(_id, _location, _name, _visibility),
 		m_parameters(_parameters),
 		m_overrides(_overrides),
 		m_returnParameters(_returnParameters),
@@ -639,10 +666,11 @@ class OverrideSpecifier: public ASTNode
 {
 public:
 	OverrideSpecifier(
+		size_t _id,
 		SourceLocation const& _location,
 		std::vector<ASTPointer<UserDefinedTypeName>> const& _overrides
 	):
-		ASTNode(_location),
+		ASTNode(_id, _location),
 		m_overrides(_overrides)
 	{
 	}
@@ -661,6 +689,7 @@ class FunctionDefinition: public CallableDeclaration, public Documented, public
 {
 public:
 	FunctionDefinition(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<ASTString> const& _name,
 		Visibility _visibility,
@@ -674,7 +703,7 @@ public:
 		ASTPointer<ParameterList> const& _returnParameters,
 		ASTPointer<Block> const& _body
 	):
-		CallableDeclaration(_location, _name, _visibility, _parameters, _isVirtual, _overrides, _returnParameters),
+		CallableDeclaration(_id, _location, _name, _visibility, _parameters, _isVirtual, _overrides, _returnParameters),
 		Documented(_documentation),
 		ImplementationOptional(_body != nullptr),
 		m_stateMutability(_stateMutability),
@@ -744,6 +773,7 @@ public:
 	enum Location { Unspecified, Storage, Memory, CallData };
 
 	VariableDeclaration(
+		size_t _id,
 		SourceLocation const& _sourceLocation,
 		ASTPointer<TypeName> const& _type,
 		ASTPointer<ASTString> const& _name,
@@ -755,7 +785,7 @@ public:
 		ASTPointer<OverrideSpecifier> const& _overrides = nullptr,
 		Location _referenceLocation = Location::Unspecified
 	):
-		Declaration(_sourceLocation, _name, _visibility),
+		Declaration(_id, _sourceLocation, _name, _visibility),
 		m_typeName(_type),
 		m_value(_value),
 		m_isStateVariable(_isStateVar),
@@ -843,6 +873,7 @@ class ModifierDefinition: public CallableDeclaration, public Documented
 {
 public:
 	ModifierDefinition(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<ASTString> const& _name,
 		ASTPointer<ASTString> const& _documentation,
@@ -851,7 +882,7 @@ public:
 		ASTPointer<OverrideSpecifier> const& _overrides,
 		ASTPointer<Block> const& _body
 	):
-		CallableDeclaration(_location, _name, Visibility::Internal, _parameters, _isVirtual, _overrides),
+		CallableDeclaration(_id, _location, _name, Visibility::Internal, _parameters, _isVirtual, _overrides),
 		Documented(_documentation),
 		m_body(_body)
 	{
@@ -877,11 +908,12 @@ class ModifierInvocation: public ASTNode
 {
 public:
 	ModifierInvocation(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<Identifier> const& _name,
 		std::unique_ptr<std::vector<ASTPointer<Expression>>> _arguments
 	):
-		ASTNode(_location), m_modifierName(_name), m_arguments(std::move(_arguments)) {}
+		ASTNode(_id, _location), m_modifierName(_name), m_arguments(std::move(_arguments)) {}
 
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
@@ -904,13 +936,14 @@ class EventDefinition: public CallableDeclaration, public Documented
 {
 public:
 	EventDefinition(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<ASTString> const& _name,
 		ASTPointer<ASTString> const& _documentation,
 		ASTPointer<ParameterList> const& _parameters,
 		bool _anonymous = false
 	):
-		CallableDeclaration(_location, _name, Visibility::Default, _parameters),
+		CallableDeclaration(_id, _location, _name, Visibility::Default, _parameters),
 		Documented(_documentation),
 		m_anonymous(_anonymous)
 	{
@@ -937,8 +970,8 @@ private:
 class MagicVariableDeclaration: public Declaration
 {
 public:
-	MagicVariableDeclaration(ASTString const& _name, Type const* _type):
-		Declaration(SourceLocation(), std::make_shared<ASTString>(_name)), m_type(_type) {}
+	MagicVariableDeclaration(size_t _id, ASTString const& _name, Type const* _type):
+		Declaration(_id, SourceLocation(), std::make_shared<ASTString>(_name)), m_type(_type) {}
 
 	void accept(ASTVisitor&) override
 	{
@@ -969,7 +1002,7 @@ private:
 class TypeName: public ASTNode
 {
 protected:
-	explicit TypeName(SourceLocation const& _location): ASTNode(_location) {}
+	explicit TypeName(size_t _id, SourceLocation const& _location): ASTNode(_id, _location) {}
 
 public:
 	TypeNameAnnotation& annotation() const override;
@@ -983,10 +1016,11 @@ class ElementaryTypeName: public TypeName
 {
 public:
 	ElementaryTypeName(
+		size_t _id,
 		SourceLocation const& _location,
 		ElementaryTypeNameToken const& _elem,
 		std::optional<StateMutability> _stateMutability = {}
-	): TypeName(_location), m_type(_elem), m_stateMutability(_stateMutability)
+	): TypeName(_id, _location), m_type(_elem), m_stateMutability(_stateMutability)
 	{
 		solAssert(!_stateMutability.has_value() || _elem.token() == Token::Address, "");
 	}
@@ -1009,8 +1043,8 @@ private:
 class UserDefinedTypeName: public TypeName
 {
 public:
-	UserDefinedTypeName(SourceLocation const& _location, std::vector<ASTString> const& _namePath):
-		TypeName(_location), m_namePath(_namePath) {}
+	UserDefinedTypeName(size_t _id, SourceLocation const& _location, std::vector<ASTString> const& _namePath):
+		TypeName(_id, _location), m_namePath(_namePath) {}
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
 
@@ -1029,13 +1063,14 @@ class FunctionTypeName: public TypeName
 {
 public:
 	FunctionTypeName(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<ParameterList> const& _parameterTypes,
 		ASTPointer<ParameterList> const& _returnTypes,
 		Visibility _visibility,
 		StateMutability _stateMutability
 	):
-		TypeName(_location), m_parameterTypes(_parameterTypes), m_returnTypes(_returnTypes),
+		TypeName(_id, _location), m_parameterTypes(_parameterTypes), m_returnTypes(_returnTypes),
 		m_visibility(_visibility), m_stateMutability(_stateMutability)
 	{}
 	void accept(ASTVisitor& _visitor) override;
@@ -1067,11 +1102,12 @@ class Mapping: public TypeName
 {
 public:
 	Mapping(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<ElementaryTypeName> const& _keyType,
 		ASTPointer<TypeName> const& _valueType
 	):
-		TypeName(_location), m_keyType(_keyType), m_valueType(_valueType) {}
+		TypeName(_id, _location), m_keyType(_keyType), m_valueType(_valueType) {}
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
 
@@ -1090,11 +1126,12 @@ class ArrayTypeName: public TypeName
 {
 public:
 	ArrayTypeName(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<TypeName> const& _baseType,
 		ASTPointer<Expression> const& _length
 	):
-		TypeName(_location), m_baseType(_baseType), m_length(_length) {}
+		TypeName(_id, _location), m_baseType(_baseType), m_length(_length) {}
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
 
@@ -1119,9 +1156,10 @@ class Statement: public ASTNode, public Documented
 {
 public:
 	explicit Statement(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<ASTString> const& _docString
-	): ASTNode(_location), Documented(_docString) {}
+	): ASTNode(_id, _location), Documented(_docString) {}
 
 	StatementAnnotation& annotation() const override;
 };
@@ -1133,12 +1171,13 @@ class InlineAssembly: public Statement
 {
 public:
 	InlineAssembly(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<ASTString> const& _docString,
 		yul::Dialect const& _dialect,
 		std::shared_ptr<yul::Block> const& _operations
 	):
-		Statement(_location, _docString), m_dialect(_dialect), m_operations(_operations) {}
+		Statement(_id, _location, _docString), m_dialect(_dialect), m_operations(_operations) {}
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
 
@@ -1159,11 +1198,12 @@ class Block: public Statement, public Scopable
 {
 public:
 	Block(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<ASTString> const& _docString,
 		std::vector<ASTPointer<Statement>> const& _statements
 	):
-		Statement(_location, _docString), m_statements(_statements) {}
+		Statement(_id, _location, _docString), m_statements(_statements) {}
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
 
@@ -1181,9 +1221,10 @@ class PlaceholderStatement: public Statement
 {
 public:
 	explicit PlaceholderStatement(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<ASTString> const& _docString
-	): Statement(_location, _docString) {}
+	): Statement(_id, _location, _docString) {}
 
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
@@ -1197,13 +1238,14 @@ class IfStatement: public Statement
 {
 public:
 	IfStatement(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<ASTString> const& _docString,
 		ASTPointer<Expression> const& _condition,
 		ASTPointer<Statement> const& _trueBody,
 		ASTPointer<Statement> const& _falseBody
 	):
-		Statement(_location, _docString),
+		Statement(_id, _location, _docString),
 		m_condition(_condition),
 		m_trueBody(_trueBody),
 		m_falseBody(_falseBody)
@@ -1231,12 +1273,13 @@ class TryCatchClause: public ASTNode, public Scopable
 {
 public:
 	TryCatchClause(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<ASTString> const& _errorName,
 		ASTPointer<ParameterList> const& _parameters,
 		ASTPointer<Block> const& _block
 	):
-		ASTNode(_location),
+		ASTNode(_id, _location),
 		m_errorName(_errorName),
 		m_parameters(_parameters),
 		m_block(_block)
@@ -1272,12 +1315,13 @@ class TryStatement: public Statement
 {
 public:
 	TryStatement(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<ASTString> const& _docString,
 		ASTPointer<Expression> const& _externalCall,
 		std::vector<ASTPointer<TryCatchClause>> const& _clauses
 	):
-		Statement(_location, _docString),
+		Statement(_id, _location, _docString),
 		m_externalCall(_externalCall),
 		m_clauses(_clauses)
 	{}
@@ -1299,22 +1343,24 @@ class BreakableStatement: public Statement
 {
 public:
 	explicit BreakableStatement(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<ASTString> const& _docString
-	): Statement(_location, _docString) {}
+	): Statement(_id, _location, _docString) {}
 };
 
 class WhileStatement: public BreakableStatement
 {
 public:
 	WhileStatement(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<ASTString> const& _docString,
 		ASTPointer<Expression> const& _condition,
 		ASTPointer<Statement> const& _body,
 		bool _isDoWhile
 	):
-		BreakableStatement(_location, _docString), m_condition(_condition), m_body(_body),
+		BreakableStatement(_id, _location, _docString), m_condition(_condition), m_body(_body),
 		m_isDoWhile(_isDoWhile) {}
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
@@ -1336,6 +1382,7 @@ class ForStatement: public BreakableStatement, public Scopable
 {
 public:
 	ForStatement(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<ASTString> const& _docString,
 		ASTPointer<Statement> const& _initExpression,
@@ -1343,7 +1390,7 @@ public:
 		ASTPointer<ExpressionStatement> const& _loopExpression,
 		ASTPointer<Statement> const& _body
 	):
-		BreakableStatement(_location, _docString),
+		BreakableStatement(_id, _location, _docString),
 		m_initExpression(_initExpression),
 		m_condExpression(_conditionExpression),
 		m_loopExpression(_loopExpression),
@@ -1371,8 +1418,8 @@ private:
 class Continue: public Statement
 {
 public:
-	explicit Continue(SourceLocation const& _location, ASTPointer<ASTString> const& _docString):
-		Statement(_location, _docString) {}
+	explicit Continue(size_t _id, SourceLocation const& _location, ASTPointer<ASTString> const& _docString):
+		Statement(_id, _location, _docString) {}
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
 };
@@ -1380,8 +1427,8 @@ public:
 class Break: public Statement
 {
 public:
-	explicit Break(SourceLocation const& _location, ASTPointer<ASTString> const& _docString):
-		Statement(_location, _docString) {}
+	explicit Break(size_t _id, SourceLocation const& _location, ASTPointer<ASTString> const& _docString):
+		Statement(_id, _location, _docString) {}
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
 };
@@ -1390,10 +1437,11 @@ class Return: public Statement
 {
 public:
 	Return(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<ASTString> const& _docString,
 		ASTPointer<Expression> _expression
-	): Statement(_location, _docString), m_expression(_expression) {}
+	): Statement(_id, _location, _docString), m_expression(_expression) {}
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
 
@@ -1411,8 +1459,8 @@ private:
 class Throw: public Statement
 {
 public:
-	explicit Throw(SourceLocation const& _location, ASTPointer<ASTString> const& _docString):
-		Statement(_location, _docString) {}
+	explicit Throw(size_t _id, SourceLocation const& _location, ASTPointer<ASTString> const& _docString):
+		Statement(_id, _location, _docString) {}
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
 };
@@ -1424,11 +1472,12 @@ class EmitStatement: public Statement
 {
 public:
 	explicit EmitStatement(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<ASTString> const& _docString,
 		ASTPointer<FunctionCall> const& _functionCall
 	):
-		Statement(_location, _docString), m_eventCall(_functionCall) {}
+		Statement(_id, _location, _docString), m_eventCall(_functionCall) {}
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
 
@@ -1450,12 +1499,13 @@ class VariableDeclarationStatement: public Statement
 {
 public:
 	VariableDeclarationStatement(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<ASTString> const& _docString,
 		std::vector<ASTPointer<VariableDeclaration>> const& _variables,
 		ASTPointer<Expression> const& _initialValue
 	):
-		Statement(_location, _docString), m_variables(_variables), m_initialValue(_initialValue) {}
+		Statement(_id, _location, _docString), m_variables(_variables), m_initialValue(_initialValue) {}
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
 
@@ -1479,11 +1529,12 @@ class ExpressionStatement: public Statement
 {
 public:
 	ExpressionStatement(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<ASTString> const& _docString,
 		ASTPointer<Expression> _expression
 	):
-		Statement(_location, _docString), m_expression(_expression) {}
+		Statement(_id, _location, _docString), m_expression(_expression) {}
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
 
@@ -1506,7 +1557,7 @@ private:
 class Expression: public ASTNode
 {
 public:
-	explicit Expression(SourceLocation const& _location): ASTNode(_location) {}
+	explicit Expression(size_t _id, SourceLocation const& _location): ASTNode(_id, _location) {}
 
 	ExpressionAnnotation& annotation() const override;
 };
@@ -1515,12 +1566,13 @@ class Conditional: public Expression
 {
 public:
 	Conditional(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<Expression> const& _condition,
 		ASTPointer<Expression> const& _trueExpression,
 		ASTPointer<Expression> const& _falseExpression
 	):
-		Expression(_location),
+		Expression(_id, _location),
 		m_condition(_condition),
 		m_trueExpression(_trueExpression),
 		m_falseExpression(_falseExpression)
@@ -1544,12 +1596,13 @@ class Assignment: public Expression
 {
 public:
 	Assignment(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<Expression> const& _leftHandSide,
 		Token _assignmentOperator,
 		ASTPointer<Expression> const& _rightHandSide
 	):
-		Expression(_location),
+		Expression(_id, _location),
 		m_leftHandSide(_leftHandSide),
 		m_assigmentOperator(_assignmentOperator),
 		m_rightHandSide(_rightHandSide)
@@ -1581,11 +1634,12 @@ class TupleExpression: public Expression
 {
 public:
 	TupleExpression(
+		size_t _id,
 		SourceLocation const& _location,
 		std::vector<ASTPointer<Expression>> const& _components,
 		bool _isArray
 	):
-		Expression(_location),
+		Expression(_id, _location),
 		m_components(_components),
 		m_isArray(_isArray) {}
 	void accept(ASTVisitor& _visitor) override;
@@ -1607,12 +1661,13 @@ class UnaryOperation: public Expression
 {
 public:
 	UnaryOperation(
+		size_t _id,
 		SourceLocation const& _location,
 		Token _operator,
 		ASTPointer<Expression> const& _subExpression,
 		bool _isPrefix
 	):
-		Expression(_location),
+		Expression(_id, _location),
 		m_operator(_operator),
 		m_subExpression(_subExpression),
 		m_isPrefix(_isPrefix)
@@ -1640,12 +1695,13 @@ class BinaryOperation: public Expression
 {
 public:
 	BinaryOperation(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<Expression> const& _left,
 		Token _operator,
 		ASTPointer<Expression> const& _right
 	):
-		Expression(_location), m_left(_left), m_operator(_operator), m_right(_right)
+		Expression(_id, _location), m_left(_left), m_operator(_operator), m_right(_right)
 	{
 		solAssert(TokenTraits::isBinaryOp(_operator) || TokenTraits::isCompareOp(_operator), "");
 	}
@@ -1671,12 +1727,13 @@ class FunctionCall: public Expression
 {
 public:
 	FunctionCall(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<Expression> const& _expression,
 		std::vector<ASTPointer<Expression>> const& _arguments,
 		std::vector<ASTPointer<ASTString>> const& _names
 	):
-		Expression(_location), m_expression(_expression), m_arguments(_arguments), m_names(_names) {}
+		Expression(_id, _location), m_expression(_expression), m_arguments(_arguments), m_names(_names) {}
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
 
@@ -1700,10 +1757,11 @@ class NewExpression: public Expression
 {
 public:
 	NewExpression(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<TypeName> const& _typeName
 	):
-		Expression(_location), m_typeName(_typeName) {}
+		Expression(_id, _location), m_typeName(_typeName) {}
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
 
@@ -1720,11 +1778,12 @@ class MemberAccess: public Expression
 {
 public:
 	MemberAccess(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<Expression> _expression,
 		ASTPointer<ASTString> const& _memberName
 	):
-		Expression(_location), m_expression(_expression), m_memberName(_memberName) {}
+		Expression(_id, _location), m_expression(_expression), m_memberName(_memberName) {}
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
 	Expression const& expression() const { return *m_expression; }
@@ -1744,11 +1803,12 @@ class IndexAccess: public Expression
 {
 public:
 	IndexAccess(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<Expression> const& _base,
 		ASTPointer<Expression> const& _index
 	):
-		Expression(_location), m_base(_base), m_index(_index) {}
+		Expression(_id, _location), m_base(_base), m_index(_index) {}
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
 
@@ -1767,12 +1827,13 @@ class IndexRangeAccess: public Expression
 {
 public:
 	IndexRangeAccess(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<Expression> const& _base,
 		ASTPointer<Expression> const& _start,
 		ASTPointer<Expression> const& _end
 	):
-		Expression(_location), m_base(_base), m_start(_start), m_end(_end) {}
+		Expression(_id, _location), m_base(_base), m_start(_start), m_end(_end) {}
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
 
@@ -1793,7 +1854,7 @@ private:
 class PrimaryExpression: public Expression
 {
 public:
-	PrimaryExpression(SourceLocation const& _location): Expression(_location) {}
+	PrimaryExpression(size_t _id, SourceLocation const& _location): Expression(_id, _location) {}
 };
 
 /**
@@ -1803,10 +1864,11 @@ class Identifier: public PrimaryExpression
 {
 public:
 	Identifier(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<ASTString> const& _name
 	):
-		PrimaryExpression(_location), m_name(_name) {}
+		PrimaryExpression(_id, _location), m_name(_name) {}
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
 
@@ -1827,10 +1889,11 @@ class ElementaryTypeNameExpression: public PrimaryExpression
 {
 public:
 	ElementaryTypeNameExpression(
+		size_t _id,
 		SourceLocation const& _location,
 		ASTPointer<ElementaryTypeName> const& _type
 	):
-		PrimaryExpression(_location),
+		PrimaryExpression(_id, _location),
 		m_type(_type)
 	{
 	}
@@ -1864,12 +1927,13 @@ public:
 		Year = static_cast<int>(Token::SubYear)
 	};
 	Literal(
+		size_t _id,
 		SourceLocation const& _location,
 		Token _token,
 		ASTPointer<ASTString> const& _value,
 		SubDenomination _sub = SubDenomination::None
 	):
-		PrimaryExpression(_location), m_token(_token), m_value(_value), m_subDenomination(_sub) {}
+		PrimaryExpression(_id, _location), m_token(_token), m_value(_value), m_subDenomination(_sub) {}
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
 
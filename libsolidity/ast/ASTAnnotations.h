@@ -46,6 +46,7 @@ namespace solidity
 
 class Type;
 using TypePointer = Type const*;
+class InheritanceSummary;
 
 struct ASTAnnotation
 {
@@ -102,6 +103,9 @@ struct ContractDefinitionAnnotation: TypeDeclarationAnnotation, DocumentedAnnota
 	/// Mapping containing the nodes that define the arguments for base constructors.
 	/// These can either be inheritance specifiers or modifier invocations.
 	std::map<FunctionDefinition const*, ASTNode const*> baseConstructorArguments;
+	/// Summary of the inherited functions and modifiers, created on first use by
+	/// InheritanceSummary::of.
+	std::shared_ptr<InheritanceSummary> inheritanceSummary;
 };
 
 struct CallableDeclarationAnnotation: ASTAnnotation
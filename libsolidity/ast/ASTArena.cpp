@@ -0,0 +1,54 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <libsolidity/ast/ASTArena.h>
+
+#include <liblangutil/Exceptions.h>
+
+#include <cstdint>
+
+using namespace std;
+using namespace dev;
+using namespace dev::solidity;
+
+void* ASTArena::allocate(size_t _size, size_t _alignment)
+{
+	solAssert(_alignment > 0 && (_alignment & (_alignment - 1)) == 0, "Alignment has to be a power of two.");
+	solAssert(_alignment <= alignof(max_align_t), "Over-aligned allocation.");
+
+	size_t padding = (_alignment - reinterpret_cast<uintptr_t>(m_free) % _alignment) % _alignment;
+	if (padding + _size > m_remaining)
+	{
+		if (_size > c_blockSize / 4)
+		{
+			// Large objects get a block of their own, so that the current block can still be filled.
+			m_blocks.emplace_back(new char[_size]);
+			m_allocatedBytes += _size;
+			return m_blocks.back().get();
+		}
+		m_blocks.emplace_back(new char[c_blockSize]);
+		m_free = m_blocks.back().get();
+		m_remaining = c_blockSize;
+		padding = 0;
+	}
+
+	void* result = m_free + padding;
+	m_free += padding + _size;
+	m_remaining -= padding + _size;
+	m_allocatedBytes += _size;
+	return result;
+}
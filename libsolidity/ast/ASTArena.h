@@ -0,0 +1,107 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Memory arena and ID dispenser for the nodes of the abstract syntax tree.
+ */
+
+#pragma once
+
+#include <boost/noncopyable.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace dev
+{
+namespace solidity
+{
+
+/**
+ * Hands out the IDs of AST nodes. All nodes created during a compilation run take their IDs
+ * from the same dispenser, so that the IDs are unique within the run.
+ */
+class IDDispenser
+{
+public:
+	/// Creates a dispenser whose first ID is @a _lastID + 1.
+	explicit IDDispenser(size_t _lastID = 0): m_lastID(_lastID) {}
+
+	size_t next() { return ++m_lastID; }
+	/// @returns the most recently dispensed ID, which is also the number of IDs dispensed so far
+	/// if the dispenser started at zero.
+	size_t lastID() const { return m_lastID; }
+
+private:
+	size_t m_lastID = 0;
+};
+
+/**
+ * Memory arena for AST nodes and their annotations.
+ * Memory is handed out consecutively from large blocks and only released as a whole when the
+ * arena is destroyed, so the arena has to outlive all objects allocated from it. The destructors
+ * of these objects are not run by the arena.
+ * The arena is not thread-safe, parsers running concurrently have to use separate arenas.
+ */
+class ASTArena: private boost::noncopyable
+{
+public:
+	/// @returns a pointer to @a _size bytes of uninitialised memory aligned to @a _alignment.
+	void* allocate(size_t _size, size_t _alignment);
+	/// @returns the number of bytes handed out so far.
+	size_t allocatedBytes() const { return m_allocatedBytes; }
+
+private:
+	static size_t constexpr c_blockSize = 64 * 1024;
+
+	std::vector<std::unique_ptr<char[]>> m_blocks;
+	/// Start of the unused part of the most recent block.
+	char* m_free = nullptr;
+	size_t m_remaining = 0;
+	size_t m_allocatedBytes = 0;
+};
+
+/**
+ * Standard allocator handing out memory from an ASTArena, to be used with std::allocate_shared.
+ * Deallocation is a no-op.
+ */
+template <class T>
+class ASTArenaAllocator
+{
+public:
+	using value_type = T;
+
+	explicit ASTArenaAllocator(ASTArena& _arena): m_arena(&_arena) {}
+	template <class U>
+	ASTArenaAllocator(ASTArenaAllocator<U> const& _other): m_arena(&_other.arena()) {}
+
+	T* allocate(size_t _n) { return static_cast<T*>(m_arena->allocate(_n * sizeof(T), alignof(T))); }
+	void deallocate(T*, size_t) {}
+
+	ASTArena& arena() const { return *m_arena; }
+
+	template <class U>
+	bool operator==(ASTArenaAllocator<U> const& _other) const { return m_arena == &_other.arena(); }
+	template <class U>
+	bool operator!=(ASTArenaAllocator<U> const& _other) const { return !(*this == _other); }
+
+private:
+	ASTArena* m_arena;
+};
+
+}
+}
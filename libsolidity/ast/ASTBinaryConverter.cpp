@@ -0,0 +1,468 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <libsolidity/ast/ASTBinaryConverter.h>
+
+#include <libsolidity/ast/ASTJsonConverter.h>
+
+#include <liblangutil/Exceptions.h>
+
+#include <algorithm>
+#include <unordered_map>
+
+using namespace std;
+using namespace dev;
+using namespace dev::solidity;
+
+namespace
+{
+
+string const c_magic = "solbinast";
+
+using Kind = ASTBinaryValue::Kind;
+
+/// @returns the location in the form of the "src" members of the JSON AST.
+string formatSourceLocation(ASTBinaryValue::SourceLocation const& _location)
+{
+	// ASTJsonConverter writes unknown sources as size_t(-1).
+	return
+		to_string(_location.start) + ":" +
+		to_string(_location.length) + ":" +
+		(_location.sourceIndex < 0 ? to_string(size_t(-1)) : to_string(_location.sourceIndex));
+}
+
+Kind readKind(BinaryDecoder& _decoder)
+{
+	uint8_t kind = _decoder.readByte();
+	if (kind > uint8_t(Kind::Object))
+		BOOST_THROW_EXCEPTION(InvalidBinaryData());
+	return Kind(kind);
+}
+
+/// Parses a decimal number that fits into an int.
+optional<int> parseInt(string const& _value, size_t _begin, size_t _end)
+{
+	bool negative = _begin < _end && _value[_begin] == '-';
+	if (negative)
+		++_begin;
+	if (_begin == _end || _end - _begin > 10)
+		return nullopt;
+	int64_t result = 0;
+	for (size_t i = _begin; i < _end; ++i)
+		if (_value[i] < '0' || _value[i] > '9')
+			return nullopt;
+		else
+			result = result * 10 + (_value[i] - '0');
+	if (negative)
+		result = -result;
+	if (result < numeric_limits<int>::min() || result > numeric_limits<int>::max())
+		return nullopt;
+	return int(result);
+}
+
+/// @returns the source location given by @a _src, if it is in the form written by ASTJsonConverter,
+/// so that formatSourceLocation reproduces it exactly.
+optional<ASTBinaryValue::SourceLocation> parseSourceLocation(string const& _src)
+{
+	size_t firstColon = _src.find(':');
+	size_t secondColon = firstColon == string::npos ? string::npos : _src.find(':', firstColon + 1);
+	if (secondColon == string::npos)
+		return nullopt;
+
+	optional<int> start = parseInt(_src, 0, firstColon);
+	optional<int> length = parseInt(_src, firstColon + 1, secondColon);
+	optional<int> sourceIndex =
+		_src.compare(secondColon + 1, string::npos, to_string(size_t(-1))) == 0 ?
+		-1 :
+		parseInt(_src, secondColon + 1, _src.size());
+	if (!start || !length || !sourceIndex || *sourceIndex < -1)
+		return nullopt;
+
+	ASTBinaryValue::SourceLocation location{*start, *length, *sourceIndex};
+	if (formatSourceLocation(location) != _src)
+		return nullopt;
+	return location;
+}
+
+/**
+ * Writes a JSON AST in the binary AST format.
+ */
+class BinaryASTWriter
+{
+public:
+	bytes write(Json::Value const& _ast)
+	{
+		writeValue(_ast);
+		sort(m_nodes.begin(), m_nodes.end());
+
+		BinaryEncoder result;
+		result.writeBytes(bytesConstRef(reinterpret_cast<uint8_t const*>(c_magic.data()), c_magic.size()));
+		result.writeNumber(ASTBinaryConverter::formatVersion);
+		result.writeNumber(m_strings.size());
+		for (string const* str: m_strings)
+			result.writeString(*str);
+		result.writeNumber(m_values.size());
+		result.writeBytes(&m_values.data());
+		result.writeNumber(m_nodes.size());
+		for (auto const& [id, position]: m_nodes)
+		{
+			result.writeSigned(id);
+			result.writeNumber(position);
+		}
+		return move(result.data());
+	}
+
+private:
+	void writeKind(Kind _kind) { m_values.writeByte(uint8_t(_kind)); }
+
+	void writeValue(Json::Value const& _value)
+	{
+		switch (_value.type())
+		{
+		case Json::nullValue:
+			writeKind(Kind::Null);
+			break;
+		case Json::booleanValue:
+			writeKind(_value.asBool() ? Kind::True : Kind::False);
+			break;
+		case Json::intValue:
+			writeKind(Kind::Int);
+			m_values.writeSigned(_value.asInt64());
+			break;
+		case Json::uintValue:
+			writeKind(Kind::UInt);
+			m_values.writeNumber(_value.asUInt64());
+			break;
+		case Json::realValue:
+			solAssert(false, "Unexpected real number in AST.");
+			break;
+		case Json::stringValue:
+			writeKind(Kind::String);
+			m_values.writeNumber(stringIndex(_value.asString()));
+			break;
+		case Json::arrayValue:
+		{
+			size_t sizePosition = startContainer(Kind::Array, _value.size());
+			for (Json::Value const& element: _value)
+				writeValue(element);
+			finishContainer(sizePosition);
+			break;
+		}
+		case Json::objectValue:
+		{
+			Json::Value const& id = _value["id"];
+			if (id.isInt64() && _value["nodeType"].isString())
+				m_nodes.emplace_back(id.asInt64(), m_values.size());
+
+			size_t sizePosition = startContainer(Kind::Object, _value.size());
+			for (auto it = _value.begin(); it != _value.end(); ++it)
+			{
+				string name = it.name();
+				m_values.writeNumber(stringIndex(name));
+				optional<ASTBinaryValue::SourceLocation> location;
+				if (name == "src" && it->isString())
+					location = parseSourceLocation(it->asString());
+				if (location)
+				{
+					writeKind(Kind::SourceLocation);
+					m_values.writeSigned(location->start);
+					m_values.writeSigned(location->length);
+					m_values.writeSigned(location->sourceIndex);
+				}
+				else
+					writeValue(*it);
+			}
+			finishContainer(sizePosition);
+			break;
+		}
+		}
+	}
+
+	/// Writes the start of an array or object and @returns the position of its size.
+	size_t startContainer(Kind _kind, size_t _elementCount)
+	{
+		writeKind(_kind);
+		size_t sizePosition = m_values.size();
+		m_values.writeUInt32(0);
+		m_values.writeNumber(_elementCount);
+		return sizePosition;
+	}
+
+	void finishContainer(size_t _sizePosition)
+	{
+		size_t size = m_values.size() - _sizePosition - 4;
+		solAssert(size <= numeric_limits<uint32_t>::max(), "AST value too large for the binary format.");
+		m_values.patchUInt32(_sizePosition, uint32_t(size));
+	}
+
+	size_t stringIndex(string const& _string)
+	{
+		auto [it, inserted] = m_stringIndices.emplace(_string, m_strings.size());
+		if (inserted)
+			m_strings.push_back(&it->first);
+		return it->second;
+	}
+
+	BinaryEncoder m_values;
+	unordered_map<string, size_t> m_stringIndices;
+	/// Strings in the order of their indices, pointing to the keys of m_stringIndices.
+	vector<string const*> m_strings;
+	vector<pair<int64_t, size_t>> m_nodes;
+};
+
+}
+
+bytes ASTBinaryConverter::toBinary(ASTNode const& _node) const
+{
+	return fromJson(ASTJsonConverter(false, m_sourceIndices).toJson(_node));
+}
+
+bytes ASTBinaryConverter::fromJson(Json::Value const& _ast)
+{
+	return BinaryASTWriter().write(_ast);
+}
+
+ASTBinaryValue::Kind ASTBinaryValue::kind() const
+{
+	BinaryDecoder decoder(m_reader->m_values, m_position);
+	return readKind(decoder);
+}
+
+bool ASTBinaryValue::asBool() const
+{
+	Kind valueKind = kind();
+	solAssert(valueKind == Kind::False || valueKind == Kind::True, "");
+	return valueKind == Kind::True;
+}
+
+int64_t ASTBinaryValue::asInt() const
+{
+	solAssert(kind() == Kind::Int, "");
+	return contents().readSigned();
+}
+
+uint64_t ASTBinaryValue::asUInt() const
+{
+	solAssert(kind() == Kind::UInt, "");
+	return contents().readNumber();
+}
+
+string const& ASTBinaryValue::asString() const
+{
+	solAssert(kind() == Kind::String, "");
+	return m_reader->stringAt(contents().readNumber());
+}
+
+ASTBinaryValue::SourceLocation ASTBinaryValue::asSourceLocation() const
+{
+	solAssert(kind() == Kind::SourceLocation, "");
+	BinaryDecoder decoder = contents();
+	SourceLocation location;
+	location.start = decoder.readInt();
+	location.length = decoder.readInt();
+	location.sourceIndex = decoder.readInt();
+	if (location.sourceIndex < -1)
+		BOOST_THROW_EXCEPTION(InvalidBinaryData());
+	return location;
+}
+
+size_t ASTBinaryValue::size() const
+{
+	Kind valueKind = kind();
+	solAssert(valueKind == Kind::Array || valueKind == Kind::Object, "");
+	return elementsStart(valueKind).readNumber();
+}
+
+vector<ASTBinaryValue> ASTBinaryValue::elements() const
+{
+	BinaryDecoder decoder = elementsStart(Kind::Array);
+	vector<ASTBinaryValue> result;
+	uint64_t count = decoder.readNumber();
+	size_t position = decoder.position();
+	for (uint64_t i = 0; i < count; ++i)
+	{
+		result.emplace_back(ASTBinaryValue(*m_reader, position));
+		position = m_reader->skip(position);
+	}
+	return result;
+}
+
+vector<pair<string const*, ASTBinaryValue>> ASTBinaryValue::members() const
+{
+	BinaryDecoder decoder = elementsStart(Kind::Object);
+	vector<pair<string const*, ASTBinaryValue>> result;
+	for (uint64_t count = decoder.readNumber(); count > 0; --count)
+	{
+		string const& name = m_reader->stringAt(decoder.readNumber());
+		size_t position = decoder.position();
+		result.emplace_back(&name, ASTBinaryValue(*m_reader, position));
+		decoder = BinaryDecoder(m_reader->m_values, m_reader->skip(position));
+	}
+	return result;
+}
+
+optional<ASTBinaryValue> ASTBinaryValue::member(string const& _name) const
+{
+	BinaryDecoder decoder = elementsStart(Kind::Object);
+	for (uint64_t count = decoder.readNumber(); count > 0; --count)
+	{
+		string const& name = m_reader->stringAt(decoder.readNumber());
+		size_t position = decoder.position();
+		if (name == _name)
+			return ASTBinaryValue(*m_reader, position);
+		decoder = BinaryDecoder(m_reader->m_values, m_reader->skip(position));
+	}
+	return nullopt;
+}
+
+Json::Value ASTBinaryValue::toJson() const
+{
+	switch (kind())
+	{
+	case Kind::Null:
+		return Json::nullValue;
+	case Kind::False:
+		return false;
+	case Kind::True:
+		return true;
+	case Kind::Int:
+		return Json::Int64(asInt());
+	case Kind::UInt:
+		return Json::UInt64(asUInt());
+	case Kind::String:
+		return asString();
+	case Kind::SourceLocation:
+		return formatSourceLocation(asSourceLocation());
+	case Kind::Array:
+	{
+		Json::Value result(Json::arrayValue);
+		for (ASTBinaryValue const& element: elements())
+			result.append(element.toJson());
+		return result;
+	}
+	case Kind::Object:
+	{
+		Json::Value result(Json::objectValue);
+		for (auto const& [name, value]: members())
+			result[*name] = value.toJson();
+		return result;
+	}
+	}
+	solAssert(false, "");
+	return Json::nullValue;
+}
+
+BinaryDecoder ASTBinaryValue::contents() const
+{
+	BinaryDecoder decoder(m_reader->m_values, m_position);
+	decoder.readByte();
+	return decoder;
+}
+
+BinaryDecoder ASTBinaryValue::elementsStart(Kind _kind) const
+{
+	solAssert(kind() == _kind, "");
+	BinaryDecoder decoder = contents();
+	size_t size = decoder.readUInt32();
+	if (size > m_reader->m_values.size() - decoder.position())
+		BOOST_THROW_EXCEPTION(InvalidBinaryData());
+	return decoder;
+}
+
+ASTBinaryReader::ASTBinaryReader(bytesConstRef _data)
+{
+	BinaryDecoder decoder(_data);
+	bytesConstRef magic = decoder.readBytes(c_magic.size());
+	if (
+		string(magic.begin(), magic.end()) != c_magic ||
+		decoder.readNumber() != ASTBinaryConverter::formatVersion
+	)
+		BOOST_THROW_EXCEPTION(InvalidBinaryData());
+
+	// Every string and node entry takes at least one byte, which limits the counts.
+	m_strings.resize(decoder.readNumberBelow(_data.size() + 1));
+	for (string& str: m_strings)
+		str = decoder.readString();
+	m_values = decoder.readBytes(decoder.readNumberBelow(_data.size() + 1));
+	m_nodes.resize(decoder.readNumberBelow(_data.size() + 1));
+	for (size_t i = 0; i < m_nodes.size(); ++i)
+	{
+		m_nodes[i].first = decoder.readSigned();
+		m_nodes[i].second = decoder.readNumberBelow(m_values.size());
+		if (i > 0 && m_nodes[i - 1].first >= m_nodes[i].first)
+			BOOST_THROW_EXCEPTION(InvalidBinaryData());
+	}
+	if (!decoder.atEnd())
+		BOOST_THROW_EXCEPTION(InvalidBinaryData());
+}
+
+vector<int64_t> ASTBinaryReader::nodeIDs() const
+{
+	vector<int64_t> ids;
+	for (auto const& node: m_nodes)
+		ids.push_back(node.first);
+	return ids;
+}
+
+optional<ASTBinaryValue> ASTBinaryReader::node(int64_t _id) const
+{
+	auto it = lower_bound(
+		m_nodes.begin(),
+		m_nodes.end(),
+		_id,
+		[](pair<int64_t, size_t> const& _node, int64_t _id) { return _node.first < _id; }
+	);
+	if (it == m_nodes.end() || it->first != _id)
+		return nullopt;
+	return ASTBinaryValue(*this, it->second);
+}
+
+string const& ASTBinaryReader::stringAt(size_t _index) const
+{
+	if (_index >= m_strings.size())
+		BOOST_THROW_EXCEPTION(InvalidBinaryData());
+	return m_strings[_index];
+}
+
+size_t ASTBinaryReader::skip(size_t _position) const
+{
+	BinaryDecoder decoder(m_values, _position);
+	switch (readKind(decoder))
+	{
+	case Kind::Null:
+	case Kind::False:
+	case Kind::True:
+		break;
+	case Kind::Int:
+		decoder.readSigned();
+		break;
+	case Kind::UInt:
+	case Kind::String:
+		decoder.readNumber();
+		break;
+	case Kind::SourceLocation:
+		decoder.readSigned();
+		decoder.readSigned();
+		decoder.readSigned();
+		break;
+	case Kind::Array:
+	case Kind::Object:
+		decoder.readBytes(decoder.readUInt32());
+		break;
+	}
+	return decoder.position();
+}
@@ -0,0 +1,162 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Converts the AST into a compact binary format and reads that format.
+ */
+
+#pragma once
+
+#include <libsolidity/ast/ASTForward.h>
+#include <libsolidity/ast/BinaryEncoding.h>
+
+#include <libdevcore/Common.h>
+
+#include <json/json.h>
+
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace dev
+{
+namespace solidity
+{
+
+/**
+ * Converts an AST into the binary AST format, which has the same structure and content as the
+ * compact JSON AST produced by ASTJsonConverter.
+ *
+ * A binary AST starts with the string "solbinast", the version of the format, the table of all
+ * strings that are used as member names or string values and the size of the root value.
+ * Every value starts with a byte that denotes its kind (see ASTBinaryValue::Kind).
+ * Unsigned numbers are stored in LEB128 encoding, signed numbers in zigzag encoding and
+ * strings as their index into the string table. The "src" members are stored as the three
+ * numbers of the source location. Arrays and objects start with the number of bytes they take
+ * after that size as four-byte little-endian number, so that readers can skip them, followed by
+ * the number of elements and the elements. The elements of objects are preceded by the index of
+ * their name and appear in the same order as in the JSON AST.
+ * The root value is followed by the index of all nodes, which contains the ID of every node and
+ * the position of its object relative to the root value, sorted by ID.
+ */
+class ASTBinaryConverter
+{
+public:
+	static uint64_t constexpr formatVersion = 1;
+
+	/// @param _sourceIndices is used to abbreviate source names in source locations.
+	explicit ASTBinaryConverter(std::map<std::string, unsigned> _sourceIndices = std::map<std::string, unsigned>()):
+		m_sourceIndices(std::move(_sourceIndices))
+	{}
+
+	/// @returns the binary AST of @a _node.
+	bytes toBinary(ASTNode const& _node) const;
+	/// @returns the binary form of @a _ast, which has to be an AST in the compact JSON format.
+	static bytes fromJson(Json::Value const& _ast);
+
+private:
+	std::map<std::string, unsigned> m_sourceIndices;
+};
+
+class ASTBinaryReader;
+
+/**
+ * Value inside a binary AST. Values are only decoded when they are accessed and refer to the data
+ * of their reader, which has to outlive them.
+ * Accessing a value of a different kind is an error, while malformed data results in an
+ * InvalidBinaryData exception.
+ */
+class ASTBinaryValue
+{
+public:
+	enum class Kind: uint8_t { Null, False, True, Int, UInt, String, SourceLocation, Array, Object };
+
+	/// Location as given by a "src" member.
+	struct SourceLocation
+	{
+		int start;
+		int length;
+		int sourceIndex;
+	};
+
+	Kind kind() const;
+
+	bool asBool() const;
+	int64_t asInt() const;
+	uint64_t asUInt() const;
+	std::string const& asString() const;
+	SourceLocation asSourceLocation() const;
+
+	/// @returns the number of elements of an array or members of an object.
+	size_t size() const;
+	/// @returns the elements of an array.
+	std::vector<ASTBinaryValue> elements() const;
+	/// @returns the names and values of the members of an object in the order of the JSON AST.
+	std::vector<std::pair<std::string const*, ASTBinaryValue>> members() const;
+	/// @returns the value of the member @a _name of an object, if it exists.
+	std::optional<ASTBinaryValue> member(std::string const& _name) const;
+
+	/// @returns this value in the form of the compact JSON AST.
+	Json::Value toJson() const;
+
+private:
+	friend class ASTBinaryReader;
+
+	ASTBinaryValue(ASTBinaryReader const& _reader, size_t _position): m_reader(&_reader), m_position(_position) {}
+
+	/// @returns a decoder positioned after the kind of this value.
+	BinaryDecoder contents() const;
+	/// @returns a decoder positioned at the first element of this array or object.
+	BinaryDecoder elementsStart(Kind _kind) const;
+
+	ASTBinaryReader const* m_reader;
+	size_t m_position;
+};
+
+/**
+ * Reads binary ASTs created by ASTBinaryConverter.
+ */
+class ASTBinaryReader
+{
+public:
+	/// Reads the header and the node index of @a _data, which has to outlive the reader and all
+	/// values obtained from it.
+	/// Throws InvalidBinaryData if @a _data is not a binary AST of a supported format version.
+	explicit ASTBinaryReader(bytesConstRef _data);
+
+	ASTBinaryValue root() const { return ASTBinaryValue(*this, 0); }
+	/// @returns the IDs of all nodes in ascending order.
+	std::vector<int64_t> nodeIDs() const;
+	/// @returns the object of the node with the ID @a _id, if there is such a node.
+	std::optional<ASTBinaryValue> node(int64_t _id) const;
+
+private:
+	friend class ASTBinaryValue;
+
+	std::string const& stringAt(size_t _index) const;
+	/// @returns the position of the value following the value at @a _position.
+	size_t skip(size_t _position) const;
+
+	std::vector<std::string> m_strings;
+	bytesConstRef m_values;
+	/// IDs and positions of all nodes, sorted by ID.
+	std::vector<std::pair<int64_t, size_t>> m_nodes;
+};
+
+}
+}
@@ -200,7 +200,7 @@ Json::Value ASTJsonConverter::inlineAssemblyIdentifierToJson(pair<yul::Identifie
 
 void ASTJsonConverter::print(ostream& _stream, ASTNode const& _node)
 {
-	_stream << jsonPrettyPrint(toJson(_node));
+	jsonPrettyPrint(toJson(_node), _stream);
 }
 
 Json::Value&& ASTJsonConverter::toJson(ASTNode const& _node)
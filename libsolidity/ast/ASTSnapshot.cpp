@@ -0,0 +1,1214 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <libsolidity/ast/ASTSnapshot.h>
+
+#include <libsolidity/ast/AST.h>
+#include <libsolidity/ast/ASTArena.h>
+#include <libsolidity/ast/ASTVisitor.h>
+#include <libsolidity/ast/BinaryEncoding.h>
+#include <libsolidity/interface/Version.h>
+
+#include <libyul/AsmParser.h>
+#include <libyul/backends/evm/EVMDialect.h>
+
+#include <liblangutil/ErrorReporter.h>
+#include <liblangutil/Scanner.h>
+
+#include <unordered_map>
+
+using namespace std;
+using namespace dev;
+using namespace langutil;
+using namespace dev::solidity;
+
+namespace
+{
+
+/// Start of every snapshot, followed by the version of the format.
+string const c_magic = "solast";
+size_t const c_formatVersion = 1;
+
+enum class NodeKind
+{
+	Null,
+	SourceUnit,
+	PragmaDirective,
+	ImportDirective,
+	ContractDefinition,
+	InheritanceSpecifier,
+	UsingForDirective,
+	StructDefinition,
+	EnumDefinition,
+	EnumValue,
+	ParameterList,
+	OverrideSpecifier,
+	FunctionDefinition,
+	VariableDeclaration,
+	ModifierDefinition,
+	ModifierInvocation,
+	EventDefinition,
+	ElementaryTypeName,
+	UserDefinedTypeName,
+	FunctionTypeName,
+	Mapping,
+	ArrayTypeName,
+	InlineAssembly,
+	Block,
+	PlaceholderStatement,
+	IfStatement,
+	TryCatchClause,
+	TryStatement,
+	WhileStatement,
+	ForStatement,
+	Continue,
+	Break,
+	Return,
+	Throw,
+	EmitStatement,
+	VariableDeclarationStatement,
+	ExpressionStatement,
+	Conditional,
+	Assignment,
+	TupleExpression,
+	UnaryOperation,
+	BinaryOperation,
+	FunctionCall,
+	NewExpression,
+	MemberAccess,
+	IndexAccess,
+	IndexRangeAccess,
+	Identifier,
+	ElementaryTypeNameExpression,
+	Literal
+};
+
+/**
+ * Encodes an AST as a string table followed by its nodes in pre-order. Every node starts with
+ * its kind, its ID relative to the first ID of the source and its location, followed by its
+ * fields and child nodes in the order of the arguments of its constructor.
+ */
+class ASTEncoder: private ASTConstVisitor
+{
+public:
+	explicit ASTEncoder(size_t _nodeIDOffset): m_nodeIDOffset(_nodeIDOffset) {}
+
+	bytes encode(SourceUnit const& _ast)
+	{
+		writeNode(&_ast);
+		BinaryEncoder result;
+		result.writeNumber(m_strings.size());
+		for (string const* str: m_strings)
+			result.writeString(*str);
+		result.writeBytes(&m_nodes.data());
+		return move(result.data());
+	}
+
+private:
+	bool visit(SourceUnit const& _node) override
+	{
+		writeHeader(NodeKind::SourceUnit, _node);
+		writeNodes(_node.nodes());
+		return false;
+	}
+
+	bool visit(PragmaDirective const& _node) override
+	{
+		writeHeader(NodeKind::PragmaDirective, _node);
+		m_nodes.writeNumber(_node.tokens().size());
+		for (Token token: _node.tokens())
+			m_nodes.writeNumber(size_t(token));
+		writeStrings(_node.literals());
+		return false;
+	}
+
+	bool visit(ImportDirective const& _node) override
+	{
+		writeHeader(NodeKind::ImportDirective, _node);
+		writeString(_node.path());
+		writeString(_node.name());
+		m_nodes.writeNumber(_node.symbolAliases().size());
+		for (ImportDirective::SymbolAlias const& alias: _node.symbolAliases())
+		{
+			writeNode(alias.symbol.get());
+			writeOptionalString(alias.alias);
+			m_nodes.writeSigned(alias.location.start);
+			m_nodes.writeSigned(alias.location.end);
+		}
+		return false;
+	}
+
+	bool visit(ContractDefinition const& _node) override
+	{
+		writeHeader(NodeKind::ContractDefinition, _node);
+		writeString(_node.name());
+		writeOptionalString(_node.documentation());
+		writeNodes(_node.baseContracts());
+		writeNodes(_node.subNodes());
+		m_nodes.writeNumber(size_t(_node.contractKind()));
+		m_nodes.writeBool(_node.abstract());
+		return false;
+	}
+
+	bool visit(InheritanceSpecifier const& _node) override
+	{
+		writeHeader(NodeKind::InheritanceSpecifier, _node);
+		writeNode(&_node.name());
+		writeOptionalNodes(_node.arguments());
+		return false;
+	}
+
+	bool visit(UsingForDirective const& _node) override
+	{
+		writeHeader(NodeKind::UsingForDirective, _node);
+		writeNode(&_node.libraryName());
+		writeNode(_node.typeName());
+		return false;
+	}
+
+	bool visit(StructDefinition const& _node) override
+	{
+		writeHeader(NodeKind::StructDefinition, _node);
+		writeString(_node.name());
+		writeNodes(_node.members());
+		return false;
+	}
+
+	bool visit(EnumDefinition const& _node) override
+	{
+		writeHeader(NodeKind::EnumDefinition, _node);
+		writeString(_node.name());
+		writeNodes(_node.members());
+		return false;
+	}
+
+	bool visit(EnumValue const& _node) override
+	{
+		writeHeader(NodeKind::EnumValue, _node);
+		writeString(_node.name());
+		return false;
+	}
+
+	bool visit(ParameterList const& _node) override
+	{
+		writeHeader(NodeKind::ParameterList, _node);
+		writeNodes(_node.parameters());
+		return false;
+	}
+
+	bool visit(OverrideSpecifier const& _node) override
+	{
+		writeHeader(NodeKind::OverrideSpecifier, _node);
+		writeNodes(_node.overrides());
+		return false;
+	}
+
+	bool visit(FunctionDefinition const& _node) override
+	{
+		writeHeader(NodeKind::FunctionDefinition, _node);
+		writeString(_node.name());
+		writeVisibility(_node);
+		m_nodes.writeNumber(size_t(_node.stateMutability()));
+		m_nodes.writeNumber(size_t(_node.kind()));
+		m_nodes.writeBool(_node.markedVirtual());
+		writeNode(_node.overrides().get());
+		writeOptionalString(_node.documentation());
+		writeNode(&_node.parameterList());
+		writeNodes(_node.modifiers());
+		writeNode(_node.returnParameterList().get());
+		writeNode(_node.isImplemented() ? &_node.body() : nullptr);
+		return false;
+	}
+
+	bool visit(VariableDeclaration const& _node) override
+	{
+		writeHeader(NodeKind::VariableDeclaration, _node);
+		writeNode(_node.typeName());
+		writeString(_node.name());
+		writeNode(_node.value().get());
+		writeVisibility(_node);
+		m_nodes.writeBool(_node.isStateVariable());
+		m_nodes.writeBool(_node.isIndexed());
+		m_nodes.writeBool(_node.isConstant());
+		writeNode(_node.overrides().get());
+		m_nodes.writeNumber(size_t(_node.referenceLocation()));
+		return false;
+	}
+
+	bool visit(ModifierDefinition const& _node) override
+	{
+		writeHeader(NodeKind::ModifierDefinition, _node);
+		writeString(_node.name());
+		writeOptionalString(_node.documentation());
+		writeNode(&_node.parameterList());
+		m_nodes.writeBool(_node.markedVirtual());
+		writeNode(_node.overrides().get());
+		writeNode(&_node.body());
+		return false;
+	}
+
+	bool visit(ModifierInvocation const& _node) override
+	{
+		writeHeader(NodeKind::ModifierInvocation, _node);
+		writeNode(_node.name().get());
+		writeOptionalNodes(_node.arguments());
+		return false;
+	}
+
+	bool visit(EventDefinition const& _node) override
+	{
+		writeHeader(NodeKind::EventDefinition, _node);
+		writeString(_node.name());
+		writeOptionalString(_node.documentation());
+		writeNode(&_node.parameterList());
+		m_nodes.writeBool(_node.isAnonymous());
+		return false;
+	}
+
+	bool visit(ElementaryTypeName const& _node) override
+	{
+		writeHeader(NodeKind::ElementaryTypeName, _node);
+		m_nodes.writeNumber(size_t(_node.typeName().token()));
+		m_nodes.writeNumber(_node.typeName().firstNumber());
+		m_nodes.writeNumber(_node.typeName().secondNumber());
+		m_nodes.writeNumber(_node.stateMutability() ? size_t(*_node.stateMutability()) + 1 : 0);
+		return false;
+	}
+
+	bool visit(UserDefinedTypeName const& _node) override
+	{
+		writeHeader(NodeKind::UserDefinedTypeName, _node);
+		writeStrings(_node.namePath());
+		return false;
+	}
+
+	bool visit(FunctionTypeName const& _node) override
+	{
+		writeHeader(NodeKind::FunctionTypeName, _node);
+		writeNode(_node.parameterTypeList().get());
+		writeNode(_node.returnParameterTypeList().get());
+		m_nodes.writeNumber(size_t(_node.visibility()));
+		m_nodes.writeNumber(size_t(_node.stateMutability()));
+		return false;
+	}
+
+	bool visit(Mapping const& _node) override
+	{
+		writeHeader(NodeKind::Mapping, _node);
+		writeNode(&_node.keyType());
+		writeNode(&_node.valueType());
+		return false;
+	}
+
+	bool visit(ArrayTypeName const& _node) override
+	{
+		writeHeader(NodeKind::ArrayTypeName, _node);
+		writeNode(&_node.baseType());
+		writeNode(_node.length());
+		return false;
+	}
+
+	bool visit(InlineAssembly const& _node) override
+	{
+		// The block is parsed again from the source when the snapshot is read.
+		writeHeader(NodeKind::InlineAssembly, _node);
+		writeOptionalString(_node.documentation());
+		m_nodes.writeSigned(_node.operations().location.start);
+		return false;
+	}
+
+	bool visit(Block const& _node) override
+	{
+		writeHeader(NodeKind::Block, _node);
+		writeOptionalString(_node.documentation());
+		writeNodes(_node.statements());
+		return false;
+	}
+
+	bool visit(PlaceholderStatement const& _node) override
+	{
+		writeHeader(NodeKind::PlaceholderStatement, _node);
+		writeOptionalString(_node.documentation());
+		return false;
+	}
+
+	bool visit(IfStatement const& _node) override
+	{
+		writeHeader(NodeKind::IfStatement, _node);
+		writeOptionalString(_node.documentation());
+		writeNode(&_node.condition());
+		writeNode(&_node.trueStatement());
+		writeNode(_node.falseStatement());
+		return false;
+	}
+
+	bool visit(TryCatchClause const& _node) override
+	{
+		writeHeader(NodeKind::TryCatchClause, _node);
+		writeString(_node.errorName());
+		writeNode(_node.parameters());
+		writeNode(&_node.block());
+		return false;
+	}
+
+	bool visit(TryStatement const& _node) override
+	{
+		writeHeader(NodeKind::TryStatement, _node);
+		writeOptionalString(_node.documentation());
+		writeNode(&_node.externalCall());
+		writeNodes(_node.clauses());
+		return false;
+	}
+
+	bool visit(WhileStatement const& _node) override
+	{
+		writeHeader(NodeKind::WhileStatement, _node);
+		writeOptionalString(_node.documentation());
+		writeNode(&_node.condition());
+		writeNode(&_node.body());
+		m_nodes.writeBool(_node.isDoWhile());
+		return false;
+	}
+
+	bool visit(ForStatement const& _node) override
+	{
+		writeHeader(NodeKind::ForStatement, _node);
+		writeOptionalString(_node.documentation());
+		writeNode(_node.initializationExpression());
+		writeNode(_node.condition());
+		writeNode(_node.loopExpression());
+		writeNode(&_node.body());
+		return false;
+	}
+
+	bool visit(Continue const& _node) override
+	{
+		writeHeader(NodeKind::Continue, _node);
+		writeOptionalString(_node.documentation());
+		return false;
+	}
+
+	bool visit(Break const& _node) override
+	{
+		writeHeader(NodeKind::Break, _node);
+		writeOptionalString(_node.documentation());
+		return false;
+	}
+
+	bool visit(Return const& _node) override
+	{
+		writeHeader(NodeKind::Return, _node);
+		writeOptionalString(_node.documentation());
+		writeNode(_node.expression());
+		return false;
+	}
+
+	bool visit(Throw const& _node) override
+	{
+		writeHeader(NodeKind::Throw, _node);
+		writeOptionalString(_node.documentation());
+		return false;
+	}
+
+	bool visit(EmitStatement const& _node) override
+	{
+		writeHeader(NodeKind::EmitStatement, _node);
+		writeOptionalString(_node.documentation());
+		writeNode(&_node.eventCall());
+		return false;
+	}
+
+	bool visit(VariableDeclarationStatement const& _node) override
+	{
+		writeHeader(NodeKind::VariableDeclarationStatement, _node);
+		writeOptionalString(_node.documentation());
+		writeNodes(_node.declarations());
+		writeNode(_node.initialValue());
+		return false;
+	}
+
+	bool visit(ExpressionStatement const& _node) override
+	{
+		writeHeader(NodeKind::ExpressionStatement, _node);
+		writeOptionalString(_node.documentation());
+		writeNode(&_node.expression());
+		return false;
+	}
+
+	bool visit(Conditional const& _node) override
+	{
+		writeHeader(NodeKind::Conditional, _node);
+		writeNode(&_node.condition());
+		writeNode(&_node.trueExpression());
+		writeNode(&_node.falseExpression());
+		return false;
+	}
+
+	bool visit(Assignment const& _node) override
+	{
+		writeHeader(NodeKind::Assignment, _node);
+		writeNode(&_node.leftHandSide());
+		m_nodes.writeNumber(size_t(_node.assignmentOperator()));
+		writeNode(&_node.rightHandSide());
+		return false;
+	}
+
+	bool visit(TupleExpression const& _node) override
+	{
+		writeHeader(NodeKind::TupleExpression, _node);
+		writeNodes(_node.components());
+		m_nodes.writeBool(_node.isInlineArray());
+		return false;
+	}
+
+	bool visit(UnaryOperation const& _node) override
+	{
+		writeHeader(NodeKind::UnaryOperation, _node);
+		m_nodes.writeNumber(size_t(_node.getOperator()));
+		writeNode(&_node.subExpression());
+		m_nodes.writeBool(_node.isPrefixOperation());
+		return false;
+	}
+
+	bool visit(BinaryOperation const& _node) override
+	{
+		writeHeader(NodeKind::BinaryOperation, _node);
+		writeNode(&_node.leftExpression());
+		m_nodes.writeNumber(size_t(_node.getOperator()));
+		writeNode(&_node.rightExpression());
+		return false;
+	}
+
+	bool visit(FunctionCall const& _node) override
+	{
+		writeHeader(NodeKind::FunctionCall, _node);
+		writeNode(&_node.expression());
+		writeNodes(_node.arguments());
+		m_nodes.writeNumber(_node.names().size());
+		for (ASTPointer<ASTString> const& name: _node.names())
+			writeString(*name);
+		return false;
+	}
+
+	bool visit(NewExpression const& _node) override
+	{
+		writeHeader(NodeKind::NewExpression, _node);
+		writeNode(&_node.typeName());
+		return false;
+	}
+
+	bool visit(MemberAccess const& _node) override
+	{
+		writeHeader(NodeKind::MemberAccess, _node);
+		writeNode(&_node.expression());
+		writeString(_node.memberName());
+		return false;
+	}
+
+	bool visit(IndexAccess const& _node) override
+	{
+		writeHeader(NodeKind::IndexAccess, _node);
+		writeNode(&_node.baseExpression());
+		writeNode(_node.indexExpression());
+		return false;
+	}
+
+	bool visit(IndexRangeAccess const& _node) override
+	{
+		writeHeader(NodeKind::IndexRangeAccess, _node);
+		writeNode(&_node.baseExpression());
+		writeNode(_node.startExpression());
+		writeNode(_node.endExpression());
+		return false;
+	}
+
+	bool visit(Identifier const& _node) override
+	{
+		writeHeader(NodeKind::Identifier, _node);
+		writeString(_node.name());
+		return false;
+	}
+
+	bool visit(ElementaryTypeNameExpression const& _node) override
+	{
+		writeHeader(NodeKind::ElementaryTypeNameExpression, _node);
+		writeNode(&_node.type());
+		return false;
+	}
+
+	bool visit(Literal const& _node) override
+	{
+		writeHeader(NodeKind::Literal, _node);
+		m_nodes.writeNumber(size_t(_node.token()));
+		writeString(_node.value());
+		m_nodes.writeNumber(size_t(_node.subDenomination()));
+		return false;
+	}
+
+	void writeNode(ASTNode const* _node)
+	{
+		if (!_node)
+		{
+			m_nodes.writeNumber(size_t(NodeKind::Null));
+			return;
+		}
+		size_t size = m_nodes.data().size();
+		_node->accept(*this);
+		solAssert(m_nodes.data().size() > size, "AST node not supported by the snapshot.");
+	}
+	template <class T>
+	void writeNodes(vector<T> const& _nodes)
+	{
+		m_nodes.writeNumber(_nodes.size());
+		for (T const& node: _nodes)
+			writeNode(node.get());
+	}
+	void writeOptionalNodes(vector<ASTPointer<Expression>> const* _nodes)
+	{
+		m_nodes.writeBool(_nodes);
+		if (_nodes)
+			writeNodes(*_nodes);
+	}
+	void writeHeader(NodeKind _kind, ASTNode const& _node)
+	{
+		solAssert(_node.id() > m_nodeIDOffset, "");
+		m_nodes.writeNumber(size_t(_kind));
+		m_nodes.writeNumber(_node.id() - m_nodeIDOffset);
+		m_nodes.writeSigned(_node.location().start);
+		m_nodes.writeSigned(_node.location().end);
+	}
+	void writeVisibility(Declaration const& _declaration)
+	{
+		m_nodes.writeNumber(size_t(
+			_declaration.noVisibilitySpecified() ? Visibility::Default : _declaration.visibility()
+		));
+	}
+	void writeString(string const& _string)
+	{
+		auto [it, inserted] = m_stringIndices.emplace(_string, m_strings.size());
+		if (inserted)
+			m_strings.push_back(&it->first);
+		m_nodes.writeNumber(it->second);
+	}
+	/// Writes the index of the string plus one or zero if it is missing.
+	void writeOptionalString(ASTPointer<ASTString> const& _string)
+	{
+		if (!_string)
+			m_nodes.writeNumber(0);
+		else
+		{
+			auto [it, inserted] = m_stringIndices.emplace(*_string, m_strings.size());
+			if (inserted)
+				m_strings.push_back(&it->first);
+			m_nodes.writeNumber(it->second + 1);
+		}
+	}
+	void writeStrings(vector<ASTString> const& _strings)
+	{
+		m_nodes.writeNumber(_strings.size());
+		for (ASTString const& str: _strings)
+			writeString(str);
+	}
+
+	size_t m_nodeIDOffset;
+	BinaryEncoder m_nodes;
+	unordered_map<string, size_t> m_stringIndices;
+	vector<string const*> m_strings;
+};
+
+/**
+ * Recreates an AST encoded by ASTEncoder.
+ */
+class ASTDecoder
+{
+public:
+	ASTDecoder(
+		bytesConstRef _data,
+		shared_ptr<Scanner> const& _scanner,
+		size_t _nodeIDOffset,
+		ASTArena& _arena,
+		EVMVersion _evmVersion
+	):
+		m_input(_data),
+		m_scanner(_scanner),
+		m_nodeIDOffset(_nodeIDOffset),
+		m_arena(_arena),
+		m_evmVersion(_evmVersion)
+	{}
+
+	ASTPointer<SourceUnit> decode()
+	{
+		size_t stringCount = m_input.readNumber();
+		for (size_t i = 0; i < stringCount; ++i)
+			m_strings.push_back(make_shared<ASTString>(m_input.readString()));
+		ASTPointer<SourceUnit> sourceUnit = readNode<SourceUnit>();
+		if (!sourceUnit || !m_input.atEnd())
+			BOOST_THROW_EXCEPTION(InvalidBinaryData());
+		return sourceUnit;
+	}
+
+private:
+	ASTPointer<ASTNode> readAnyNode()
+	{
+		NodeKind kind = NodeKind(m_input.readNumberBelow(size_t(NodeKind::Literal) + 1));
+		if (kind == NodeKind::Null)
+			return nullptr;
+		size_t id = m_nodeIDOffset + m_input.readNumber();
+		SourceLocation location = readLocation();
+
+		switch (kind)
+		{
+		case NodeKind::Null:
+			break;
+		case NodeKind::SourceUnit:
+		{
+			vector<ASTPointer<ASTNode>> nodes = readNodes<ASTNode>();
+			return create<SourceUnit>(id, location, nodes);
+		}
+		case NodeKind::PragmaDirective:
+		{
+			vector<Token> tokens(m_input.readNumber());
+			for (Token& token: tokens)
+				token = readToken();
+			vector<ASTString> literals = readStrings();
+			return create<PragmaDirective>(id, location, tokens, literals);
+		}
+		case NodeKind::ImportDirective:
+		{
+			ASTPointer<ASTString> path = readString();
+			ASTPointer<ASTString> unitAlias = readString();
+			ImportDirective::SymbolAliasList symbolAliases(m_input.readNumber());
+			for (ImportDirective::SymbolAlias& alias: symbolAliases)
+			{
+				alias.symbol = readNode<Identifier>();
+				alias.alias = readOptionalString();
+				alias.location = readLocation();
+			}
+			return create<ImportDirective>(id, location, path, unitAlias, move(symbolAliases));
+		}
+		case NodeKind::ContractDefinition:
+		{
+			ASTPointer<ASTString> name = readString();
+			ASTPointer<ASTString> documentation = readOptionalString();
+			vector<ASTPointer<InheritanceSpecifier>> baseContracts = readNodes<InheritanceSpecifier>();
+			vector<ASTPointer<ASTNode>> subNodes = readNodes<ASTNode>();
+			auto contractKind = ContractDefinition::ContractKind(
+				m_input.readNumberBelow(size_t(ContractDefinition::ContractKind::Library) + 1)
+			);
+			bool abstract = m_input.readBool();
+			return create<ContractDefinition>(id, location, name, documentation, baseContracts, subNodes, contractKind, abstract);
+		}
+		case NodeKind::InheritanceSpecifier:
+		{
+			ASTPointer<UserDefinedTypeName> baseName = readNode<UserDefinedTypeName>();
+			unique_ptr<vector<ASTPointer<Expression>>> arguments = readOptionalNodes();
+			return create<InheritanceSpecifier>(id, location, baseName, move(arguments));
+		}
+		case NodeKind::UsingForDirective:
+		{
+			ASTPointer<UserDefinedTypeName> libraryName = readNode<UserDefinedTypeName>();
+			ASTPointer<TypeName> typeName = readNode<TypeName>();
+			return create<UsingForDirective>(id, location, libraryName, typeName);
+		}
+		case NodeKind::StructDefinition:
+		{
+			ASTPointer<ASTString> name = readString();
+			vector<ASTPointer<VariableDeclaration>> members = readNodes<VariableDeclaration>();
+			return create<StructDefinition>(id, location, name, members);
+		}
+		case NodeKind::EnumDefinition:
+		{
+			ASTPointer<ASTString> name = readString();
+			vector<ASTPointer<EnumValue>> members = readNodes<EnumValue>();
+			return create<EnumDefinition>(id, location, name, members);
+		}
+		case NodeKind::EnumValue:
+			return create<EnumValue>(id, location, readString());
+		case NodeKind::ParameterList:
+			return create<ParameterList>(id, location, readNodes<VariableDeclaration>());
+		case NodeKind::OverrideSpecifier:
+			return create<OverrideSpecifier>(id, location, readNodes<UserDefinedTypeName>());
+		case NodeKind::FunctionDefinition:
+		{
+			ASTPointer<ASTString> name = readString();
+			Visibility visibility = readVisibility();
+			StateMutability stateMutability = readStateMutability();
+			Token functionKind = readToken();
+			if (
+				functionKind != Token::Constructor &&
+				functionKind != Token::Function &&
+				functionKind != Token::Fallback &&
+				functionKind != Token::Receive
+			)
+				BOOST_THROW_EXCEPTION(InvalidBinaryData());
+			bool isVirtual = m_input.readBool();
+			ASTPointer<OverrideSpecifier> overrides = readNode<OverrideSpecifier>();
+			ASTPointer<ASTString> documentation = readOptionalString();
+			ASTPointer<ParameterList> parameters = readNode<ParameterList>();
+			vector<ASTPointer<ModifierInvocation>> modifiers = readNodes<ModifierInvocation>();
+			ASTPointer<ParameterList> returnParameters = readNode<ParameterList>();
+			ASTPointer<Block> body = readNode<Block>();
+			return create<FunctionDefinition>(
+				id,
+				location,
+				name,
+				visibility,
+				stateMutability,
+				functionKind,
+				isVirtual,
+				overrides,
+				documentation,
+				parameters,
+				modifiers,
+				returnParameters,
+				body
+			);
+		}
+		case NodeKind::VariableDeclaration:
+		{
+			ASTPointer<TypeName> typeName = readNode<TypeName>();
+			ASTPointer<ASTString> name = readString();
+			ASTPointer<Expression> value = readNode<Expression>();
+			Visibility visibility = readVisibility();
+			bool isStateVariable = m_input.readBool();
+			bool isIndexed = m_input.readBool();
+			bool isConstant = m_input.readBool();
+			ASTPointer<OverrideSpecifier> overrides = readNode<OverrideSpecifier>();
+			auto referenceLocation = VariableDeclaration::Location(
+				m_input.readNumberBelow(size_t(VariableDeclaration::Location::CallData) + 1)
+			);
+			return create<VariableDeclaration>(
+				id,
+				location,
+				typeName,
+				name,
+				value,
+				visibility,
+				isStateVariable,
+				isIndexed,
+				isConstant,
+				overrides,
+				referenceLocation
+			);
+		}
+		case NodeKind::ModifierDefinition:
+		{
+			ASTPointer<ASTString> name = readString();
+			ASTPointer<ASTString> documentation = readOptionalString();
+			ASTPointer<ParameterList> parameters = readNode<ParameterList>();
+			bool isVirtual = m_input.readBool();
+			ASTPointer<OverrideSpecifier> overrides = readNode<OverrideSpecifier>();
+			ASTPointer<Block> body = readNode<Block>();
+			return create<ModifierDefinition>(id, location, name, documentation, parameters, isVirtual, overrides, body);
+		}
+		case NodeKind::ModifierInvocation:
+		{
+			ASTPointer<Identifier> name = readNode<Identifier>();
+			unique_ptr<vector<ASTPointer<Expression>>> arguments = readOptionalNodes();
+			return create<ModifierInvocation>(id, location, name, move(arguments));
+		}
+		case NodeKind::EventDefinition:
+		{
+			ASTPointer<ASTString> name = readString();
+			ASTPointer<ASTString> documentation = readOptionalString();
+			ASTPointer<ParameterList> parameters = readNode<ParameterList>();
+			bool anonymous = m_input.readBool();
+			return create<EventDefinition>(id, location, name, documentation, parameters, anonymous);
+		}
+		case NodeKind::ElementaryTypeName:
+		{
+			Token token = readToken();
+			if (!TokenTraits::isElementaryTypeName(token))
+				BOOST_THROW_EXCEPTION(InvalidBinaryData());
+			unsigned firstNumber = unsigned(m_input.readNumberBelow(257));
+			unsigned secondNumber = unsigned(m_input.readNumberBelow(81));
+			optional<StateMutability> stateMutability;
+			if (size_t value = m_input.readNumberBelow(size_t(StateMutability::Payable) + 2))
+				stateMutability = StateMutability(value - 1);
+			return create<ElementaryTypeName>(
+				id,
+				location,
+				ElementaryTypeNameToken(token, firstNumber, secondNumber),
+				stateMutability
+			);
+		}
+		case NodeKind::UserDefinedTypeName:
+			return create<UserDefinedTypeName>(id, location, readStrings());
+		case NodeKind::FunctionTypeName:
+		{
+			ASTPointer<ParameterList> parameterTypes = readNode<ParameterList>();
+			ASTPointer<ParameterList> returnTypes = readNode<ParameterList>();
+			Visibility visibility = readVisibility();
+			StateMutability stateMutability = readStateMutability();
+			return create<FunctionTypeName>(id, location, parameterTypes, returnTypes, visibility, stateMutability);
+		}
+		case NodeKind::Mapping:
+		{
+			ASTPointer<ElementaryTypeName> keyType = readNode<ElementaryTypeName>();
+			ASTPointer<TypeName> valueType = readNode<TypeName>();
+			return create<Mapping>(id, location, keyType, valueType);
+		}
+		case NodeKind::ArrayTypeName:
+		{
+			ASTPointer<TypeName> baseType = readNode<TypeName>();
+			ASTPointer<Expression> length = readNode<Expression>();
+			return create<ArrayTypeName>(id, location, baseType, length);
+		}
+		case NodeKind::InlineAssembly:
+		{
+			ASTPointer<ASTString> documentation = readOptionalString();
+			int blockStart = m_input.readInt();
+			if (blockStart < 0 || size_t(blockStart) >= m_scanner->source().size())
+				BOOST_THROW_EXCEPTION(InvalidBinaryData());
+			yul::Dialect const& dialect = yul::EVMDialect::strictAssemblyForEVM(m_evmVersion);
+			ErrorList errors;
+			ErrorReporter errorReporter(errors);
+			m_scanner->setPosition(size_t(blockStart));
+			shared_ptr<yul::Block> block = yul::Parser(errorReporter, dialect).parse(m_scanner, true);
+			if (!block || !errors.empty())
+				BOOST_THROW_EXCEPTION(InvalidBinaryData());
+			return create<InlineAssembly>(id, location, documentation, dialect, block);
+		}
+		case NodeKind::Block:
+		{
+			ASTPointer<ASTString> documentation = readOptionalString();
+			vector<ASTPointer<Statement>> statements = readNodes<Statement>();
+			return create<Block>(id, location, documentation, statements);
+		}
+		case NodeKind::PlaceholderStatement:
+			return create<PlaceholderStatement>(id, location, readOptionalString());
+		case NodeKind::IfStatement:
+		{
+			ASTPointer<ASTString> documentation = readOptionalString();
+			ASTPointer<Expression> condition = readNode<Expression>();
+			ASTPointer<Statement> trueBody = readNode<Statement>();
+			ASTPointer<Statement> falseBody = readNode<Statement>();
+			return create<IfStatement>(id, location, documentation, condition, trueBody, falseBody);
+		}
+		case NodeKind::TryCatchClause:
+		{
+			ASTPointer<ASTString> errorName = readString();
+			ASTPointer<ParameterList> parameters = readNode<ParameterList>();
+			ASTPointer<Block> block = readNode<Block>();
+			return create<TryCatchClause>(id, location, errorName, parameters, block);
+		}
+		case NodeKind::TryStatement:
+		{
+			ASTPointer<ASTString> documentation = readOptionalString();
+			ASTPointer<Expression> externalCall = readNode<Expression>();
+			vector<ASTPointer<TryCatchClause>> clauses = readNodes<TryCatchClause>();
+			return create<TryStatement>(id, location, documentation, externalCall, clauses);
+		}
+		case NodeKind::WhileStatement:
+		{
+			ASTPointer<ASTString> documentation = readOptionalString();
+			ASTPointer<Expression> condition = readNode<Expression>();
+			ASTPointer<Statement> body = readNode<Statement>();
+			bool isDoWhile = m_input.readBool();
+			return create<WhileStatement>(id, location, documentation, condition, body, isDoWhile);
+		}
+		case NodeKind::ForStatement:
+		{
+			ASTPointer<ASTString> documentation = readOptionalString();
+			ASTPointer<Statement> initExpression = readNode<Statement>();
+			ASTPointer<Expression> condition = readNode<Expression>();
+			ASTPointer<ExpressionStatement> loopExpression = readNode<ExpressionStatement>();
+			ASTPointer<Statement> body = readNode<Statement>();
+			return create<ForStatement>(id, location, documentation, initExpression, condition, loopExpression, body);
+		}
+		case NodeKind::Continue:
+			return create<Continue>(id, location, readOptionalString());
+		case NodeKind::Break:
+			return create<Break>(id, location, readOptionalString());
+		case NodeKind::Return:
+		{
+			ASTPointer<ASTString> documentation = readOptionalString();
+			ASTPointer<Expression> expression = readNode<Expression>();
+			return create<Return>(id, location, documentation, expression);
+		}
+		case NodeKind::Throw:
+			return create<Throw>(id, location, readOptionalString());
+		case NodeKind::EmitStatement:
+		{
+			ASTPointer<ASTString> documentation = readOptionalString();
+			ASTPointer<FunctionCall> eventCall = readNode<FunctionCall>();
+			return create<EmitStatement>(id, location, documentation, eventCall);
+		}
+		case NodeKind::VariableDeclarationStatement:
+		{
+			ASTPointer<ASTString> documentation = readOptionalString();
+			vector<ASTPointer<VariableDeclaration>> variables = readNodes<VariableDeclaration>();
+			ASTPointer<Expression> initialValue = readNode<Expression>();
+			return create<VariableDeclarationStatement>(id, location, documentation, variables, initialValue);
+		}
+		case NodeKind::ExpressionStatement:
+		{
+			ASTPointer<ASTString> documentation = readOptionalString();
+			ASTPointer<Expression> expression = readNode<Expression>();
+			return create<ExpressionStatement>(id, location, documentation, expression);
+		}
+		case NodeKind::Conditional:
+		{
+			ASTPointer<Expression> condition = readNode<Expression>();
+			ASTPointer<Expression> trueExpression = readNode<Expression>();
+			ASTPointer<Expression> falseExpression = readNode<Expression>();
+			return create<Conditional>(id, location, condition, trueExpression, falseExpression);
+		}
+		case NodeKind::Assignment:
+		{
+			ASTPointer<Expression> leftHandSide = readNode<Expression>();
+			Token assignmentOperator = readToken();
+			if (!TokenTraits::isAssignmentOp(assignmentOperator))
+				BOOST_THROW_EXCEPTION(InvalidBinaryData());
+			ASTPointer<Expression> rightHandSide = readNode<Expression>();
+			return create<Assignment>(id, location, leftHandSide, assignmentOperator, rightHandSide);
+		}
+		case NodeKind::TupleExpression:
+		{
+			vector<ASTPointer<Expression>> components = readNodes<Expression>();
+			bool isArray = m_input.readBool();
+			return create<TupleExpression>(id, location, components, isArray);
+		}
+		case NodeKind::UnaryOperation:
+		{
+			Token unaryOperator = readToken();
+			if (!TokenTraits::isUnaryOp(unaryOperator))
+				BOOST_THROW_EXCEPTION(InvalidBinaryData());
+			ASTPointer<Expression> subExpression = readNode<Expression>();
+			bool isPrefix = m_input.readBool();
+			return create<UnaryOperation>(id, location, unaryOperator, subExpression, isPrefix);
+		}
+		case NodeKind::BinaryOperation:
+		{
+			ASTPointer<Expression> left = readNode<Expression>();
+			Token binaryOperator = readToken();
+			if (!TokenTraits::isBinaryOp(binaryOperator) && !TokenTraits::isCompareOp(binaryOperator))
+				BOOST_THROW_EXCEPTION(InvalidBinaryData());
+			ASTPointer<Expression> right = readNode<Expression>();
+			return create<BinaryOperation>(id, location, left, binaryOperator, right);
+		}
+		case NodeKind::FunctionCall:
+		{
+			ASTPointer<Expression> expression = readNode<Expression>();
+			vector<ASTPointer<Expression>> arguments = readNodes<Expression>();
+			vector<ASTPointer<ASTString>> names(m_input.readNumber());
+			for (ASTPointer<ASTString>& name: names)
+				name = readString();
+			return create<FunctionCall>(id, location, expression, arguments, names);
+		}
+		case NodeKind::NewExpression:
+			return create<NewExpression>(id, location, readNode<TypeName>());
+		case NodeKind::MemberAccess:
+		{
+			ASTPointer<Expression> expression = readNode<Expression>();
+			ASTPointer<ASTString> memberName = readString();
+			return create<MemberAccess>(id, location, expression, memberName);
+		}
+		case NodeKind::IndexAccess:
+		{
+			ASTPointer<Expression> base = readNode<Expression>();
+			ASTPointer<Expression> index = readNode<Expression>();
+			return create<IndexAccess>(id, location, base, index);
+		}
+		case NodeKind::IndexRangeAccess:
+		{
+			ASTPointer<Expression> base = readNode<Expression>();
+			ASTPointer<Expression> start = readNode<Expression>();
+			ASTPointer<Expression> end = readNode<Expression>();
+			return create<IndexRangeAccess>(id, location, base, start, end);
+		}
+		case NodeKind::Identifier:
+			return create<Identifier>(id, location, readString());
+		case NodeKind::ElementaryTypeNameExpression:
+			return create<ElementaryTypeNameExpression>(id, location, readNode<ElementaryTypeName>());
+		case NodeKind::Literal:
+		{
+			Token token = readToken();
+			ASTPointer<ASTString> value = readString();
+			auto subDenomination = Literal::SubDenomination(m_input.readNumberBelow(size_t(Token::NUM_TOKENS)));
+			return create<Literal>(id, location, token, value, subDenomination);
+		}
+		}
+		BOOST_THROW_EXCEPTION(InvalidBinaryData());
+	}
+
+	/// @returns the next node, which has to be missing or of type @a T.
+	template <class T>
+	ASTPointer<T> readNode()
+	{
+		ASTPointer<ASTNode> node = readAnyNode();
+		ASTPointer<T> result = dynamic_pointer_cast<T>(node);
+		if (node && !result)
+			BOOST_THROW_EXCEPTION(InvalidBinaryData());
+		return result;
+	}
+	template <class T>
+	vector<ASTPointer<T>> readNodes()
+	{
+		vector<ASTPointer<T>> nodes(m_input.readNumber());
+		for (ASTPointer<T>& node: nodes)
+			node = readNode<T>();
+		return nodes;
+	}
+	unique_ptr<vector<ASTPointer<Expression>>> readOptionalNodes()
+	{
+		if (!m_input.readBool())
+			return nullptr;
+		return make_unique<vector<ASTPointer<Expression>>>(readNodes<Expression>());
+	}
+
+	template <class T, class... Args>
+	ASTPointer<T> create(size_t _id, SourceLocation const& _location, Args&&... _args)
+	{
+		ASTPointer<T> node = allocate_shared<T>(
+			ASTArenaAllocator<T>(m_arena),
+			_id,
+			_location,
+			std::forward<Args>(_args)...
+		);
+		node->createAnnotationIn(m_arena);
+		return node;
+	}
+
+	SourceLocation readLocation()
+	{
+		int start = m_input.readInt();
+		int end = m_input.readInt();
+		return SourceLocation{start, end, m_scanner->charStream()};
+	}
+	Token readToken() { return Token(m_input.readNumberBelow(size_t(Token::NUM_TOKENS))); }
+	Visibility readVisibility() { return Visibility(m_input.readNumberBelow(size_t(Visibility::External) + 1)); }
+	StateMutability readStateMutability()
+	{
+		return StateMutability(m_input.readNumberBelow(size_t(StateMutability::Payable) + 1));
+	}
+	ASTPointer<ASTString> readString() { return m_strings.at(m_input.readNumberBelow(m_strings.size())); }
+	ASTPointer<ASTString> readOptionalString()
+	{
+		size_t index = m_input.readNumberBelow(m_strings.size() + 1);
+		return index ? m_strings[index - 1] : nullptr;
+	}
+	vector<ASTString> readStrings()
+	{
+		vector<ASTString> strings(m_input.readNumber());
+		for (ASTString& str: strings)
+			str = *readString();
+		return strings;
+	}
+
+	BinaryDecoder m_input;
+	shared_ptr<Scanner> m_scanner;
+	size_t m_nodeIDOffset;
+	ASTArena& m_arena;
+	EVMVersion m_evmVersion;
+	vector<ASTPointer<ASTString>> m_strings;
+};
+
+}
+
+void ASTSnapshotWriter::addSource(
+	string const& _path,
+	h256 const& _sourceHash,
+	SourceUnit const& _ast,
+	size_t _nodeIDOffset,
+	size_t _nodeIDCount
+)
+{
+	m_sources[_path] = Source{_sourceHash, _nodeIDCount, ASTEncoder(_nodeIDOffset).encode(_ast)};
+}
+
+bytes ASTSnapshotWriter::snapshot() const
+{
+	BinaryEncoder encoder;
+	encoder.writeString(c_magic);
+	encoder.writeNumber(c_formatVersion);
+	encoder.writeString(VersionString);
+	encoder.writeNumber(m_sources.size());
+	for (auto const& [path, source]: m_sources)
+	{
+		encoder.writeString(path);
+		encoder.writeBytes(source.hash.ref());
+		encoder.writeNumber(source.nodeIDCount);
+		encoder.writeNumber(source.ast.size());
+	}
+	for (auto const& source: m_sources)
+		encoder.writeBytes(&source.second.ast);
+	return move(encoder.data());
+}
+
+ASTSnapshotReader::ASTSnapshotReader(bytesConstRef _snapshot)
+{
+	if (_snapshot.empty())
+		return;
+	try
+	{
+		BinaryDecoder decoder(_snapshot);
+		if (
+			decoder.readString() != c_magic ||
+			decoder.readNumber() != c_formatVersion ||
+			decoder.readString() != VersionString
+		)
+			return;
+		vector<pair<string, Source>> sources(decoder.readNumber());
+		vector<size_t> astSizes;
+		for (auto& [path, source]: sources)
+		{
+			path = decoder.readString();
+			source.hash = h256(decoder.readBytes(h256::size));
+			source.nodeIDCount = decoder.readNumber();
+			astSizes.push_back(decoder.readNumber());
+		}
+		for (size_t i = 0; i < sources.size(); ++i)
+		{
+			sources[i].second.ast = decoder.readBytes(astSizes[i]);
+			m_sources.insert(sources[i]);
+		}
+	}
+	catch (InvalidBinaryData const&)
+	{
+		m_sources.clear();
+	}
+}
+
+bool ASTSnapshotReader::contains(string const& _path, h256 const& _sourceHash) const
+{
+	auto it = m_sources.find(_path);
+	return it != m_sources.end() && it->second.hash == _sourceHash;
+}
+
+size_t ASTSnapshotReader::nodeIDCount(string const& _path) const
+{
+	return m_sources.at(_path).nodeIDCount;
+}
+
+ASTPointer<SourceUnit> ASTSnapshotReader::readAST(
+	string const& _path,
+	shared_ptr<Scanner> const& _scanner,
+	size_t _nodeIDOffset,
+	ASTArena& _arena,
+	EVMVersion _evmVersion
+) const
+{
+	try
+	{
+		return ASTDecoder(m_sources.at(_path).ast, _scanner, _nodeIDOffset, _arena, _evmVersion).decode();
+	}
+	catch (InvalidBinaryData const&)
+	{
+		return nullptr;
+	}
+}
@@ -0,0 +1,125 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Binary snapshots of the ASTs of a set of sources, which allow a later compilation
+ * to load the ASTs instead of parsing the sources again.
+ */
+
+#pragma once
+
+#include <libsolidity/ast/ASTForward.h>
+
+#include <liblangutil/EVMVersion.h>
+
+#include <libdevcore/Common.h>
+#include <libdevcore/FixedHash.h>
+
+#include <map>
+#include <memory>
+#include <string>
+
+namespace langutil
+{
+class Scanner;
+}
+
+namespace dev
+{
+namespace solidity
+{
+
+class ASTArena;
+
+/**
+ * Writes the ASTs of sources as returned by the parser into a snapshot.
+ *
+ * The snapshot starts with the version of the compiler and an index of the sources, which
+ * contains the path, the keccak256 hash of the contents and the size of the AST of every
+ * source. The ASTs follow, each with its own string table, so that a single AST can be read
+ * without decoding the others. All data is position-independent, so the snapshot can be
+ * used directly from a memory-mapped file.
+ * Annotations are not part of the snapshot.
+ */
+class ASTSnapshotWriter
+{
+public:
+	/// Adds the AST of the source @a _path whose contents have the hash @a _sourceHash.
+	/// The nodes of the AST took the IDs from @a _nodeIDOffset + 1 to @a _nodeIDOffset + @a _nodeIDCount.
+	void addSource(
+		std::string const& _path,
+		h256 const& _sourceHash,
+		SourceUnit const& _ast,
+		size_t _nodeIDOffset,
+		size_t _nodeIDCount
+	);
+
+	/// @returns the snapshot of all sources added so far.
+	bytes snapshot() const;
+
+private:
+	struct Source
+	{
+		h256 hash;
+		size_t nodeIDCount;
+		bytes ast;
+	};
+	std::map<std::string, Source> m_sources;
+};
+
+/**
+ * Reads the ASTs from a snapshot created by ASTSnapshotWriter.
+ */
+class ASTSnapshotReader
+{
+public:
+	/// Reads the index of @a _snapshot, which has to outlive the reader.
+	/// Snapshots that are malformed or were created by a different compiler version are treated
+	/// as if they were empty.
+	explicit ASTSnapshotReader(bytesConstRef _snapshot = bytesConstRef());
+
+	/// @returns true if the snapshot contains the AST of the source @a _path for contents
+	/// with the hash @a _sourceHash.
+	bool contains(std::string const& _path, h256 const& _sourceHash) const;
+	/// @returns the number of node IDs taken by the AST of @a _path, which has to be contained.
+	size_t nodeIDCount(std::string const& _path) const;
+
+	/// Recreates the AST of the source @a _path, which has to be contained. The locations of the
+	/// nodes refer to the source of @a _scanner, which is also used to parse inline assembly blocks
+	/// again for @a _evmVersion. The IDs of the nodes are the ones given to them by the parser,
+	/// shifted by @a _nodeIDOffset, and the nodes are allocated from @a _arena.
+	/// Must not be called while sources are parsed concurrently.
+	/// @returns nullptr if the AST cannot be recreated, in which case the source has to be parsed.
+	ASTPointer<SourceUnit> readAST(
+		std::string const& _path,
+		std::shared_ptr<langutil::Scanner> const& _scanner,
+		size_t _nodeIDOffset,
+		ASTArena& _arena,
+		langutil::EVMVersion _evmVersion
+	) const;
+
+private:
+	struct Source
+	{
+		h256 hash;
+		size_t nodeIDCount;
+		bytesConstRef ast;
+	};
+	std::map<std::string, Source> m_sources;
+};
+
+}
+}
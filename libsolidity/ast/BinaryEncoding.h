@@ -0,0 +1,166 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Primitives of the binary formats used for ASTs.
+ */
+
+#pragma once
+
+#include <libdevcore/Common.h>
+#include <libdevcore/Exceptions.h>
+
+#include <cstdint>
+#include <limits>
+#include <string>
+
+namespace dev
+{
+namespace solidity
+{
+
+struct InvalidBinaryData: virtual Exception {};
+
+/**
+ * Appends unsigned numbers in LEB128 encoding, signed numbers in zigzag encoding, fixed-size
+ * numbers and length-prefixed strings to a byte array.
+ */
+class BinaryEncoder
+{
+public:
+	void writeNumber(uint64_t _value)
+	{
+		for (; _value >= 0x80; _value >>= 7)
+			m_data.push_back(uint8_t(_value | 0x80));
+		m_data.push_back(uint8_t(_value));
+	}
+	/// Writes signed numbers in zigzag encoding, so that small negative numbers stay short.
+	void writeSigned(int64_t _value)
+	{
+		writeNumber(_value < 0 ? ((uint64_t(-(_value + 1))) << 1) + 1 : uint64_t(_value) << 1);
+	}
+	void writeBool(bool _value) { m_data.push_back(_value ? 1 : 0); }
+	void writeUInt32(uint32_t _value)
+	{
+		for (size_t i = 0; i < 4; ++i)
+			m_data.push_back(uint8_t(_value >> (8 * i)));
+	}
+	/// Overwrites the four bytes at @a _position with @a _value.
+	void patchUInt32(size_t _position, uint32_t _value)
+	{
+		for (size_t i = 0; i < 4; ++i)
+			m_data.at(_position + i) = uint8_t(_value >> (8 * i));
+	}
+	void writeByte(uint8_t _value) { m_data.push_back(_value); }
+	void writeBytes(bytesConstRef _bytes) { m_data.insert(m_data.end(), _bytes.begin(), _bytes.end()); }
+	void writeString(std::string const& _string)
+	{
+		writeNumber(_string.size());
+		writeBytes(bytesConstRef(reinterpret_cast<uint8_t const*>(_string.data()), _string.size()));
+	}
+
+	size_t size() const { return m_data.size(); }
+	bytes& data() { return m_data; }
+
+private:
+	bytes m_data;
+};
+
+/**
+ * Reads the data written by BinaryEncoder and throws InvalidBinaryData if it is malformed.
+ */
+class BinaryDecoder
+{
+public:
+	explicit BinaryDecoder(bytesConstRef _data, size_t _position = 0): m_data(_data), m_position(_position)
+	{
+		if (m_position > m_data.size())
+			BOOST_THROW_EXCEPTION(InvalidBinaryData());
+	}
+
+	uint64_t readNumber()
+	{
+		uint64_t value = 0;
+		for (unsigned shift = 0; ; shift += 7)
+		{
+			if (shift >= 64)
+				BOOST_THROW_EXCEPTION(InvalidBinaryData());
+			uint8_t byte = readByte();
+			value |= uint64_t(byte & 0x7f) << shift;
+			if (!(byte & 0x80))
+				return value;
+		}
+	}
+	int64_t readSigned()
+	{
+		uint64_t value = readNumber();
+		return (value & 1) ? -int64_t(value >> 1) - 1 : int64_t(value >> 1);
+	}
+	/// Reads a signed number that has to fit into an int.
+	int readInt()
+	{
+		int64_t value = readSigned();
+		if (value < std::numeric_limits<int>::min() || value > std::numeric_limits<int>::max())
+			BOOST_THROW_EXCEPTION(InvalidBinaryData());
+		return int(value);
+	}
+	/// Reads a number that has to be smaller than @a _limit.
+	size_t readNumberBelow(size_t _limit)
+	{
+		uint64_t value = readNumber();
+		if (value >= _limit)
+			BOOST_THROW_EXCEPTION(InvalidBinaryData());
+		return size_t(value);
+	}
+	bool readBool() { return readNumberBelow(2) == 1; }
+	uint32_t readUInt32()
+	{
+		bytesConstRef data = readBytes(4);
+		uint32_t value = 0;
+		for (size_t i = 0; i < 4; ++i)
+			value |= uint32_t(data[i]) << (8 * i);
+		return value;
+	}
+	uint8_t readByte()
+	{
+		if (m_position >= m_data.size())
+			BOOST_THROW_EXCEPTION(InvalidBinaryData());
+		return m_data[m_position++];
+	}
+	bytesConstRef readBytes(size_t _size)
+	{
+		if (_size > m_data.size() - m_position)
+			BOOST_THROW_EXCEPTION(InvalidBinaryData());
+		bytesConstRef result = m_data.cropped(m_position, _size);
+		m_position += _size;
+		return result;
+	}
+	std::string readString()
+	{
+		bytesConstRef data = readBytes(readNumberBelow(m_data.size() - m_position + 1));
+		return std::string(data.begin(), data.end());
+	}
+
+	size_t position() const { return m_position; }
+	bool atEnd() const { return m_position == m_data.size(); }
+
+private:
+	bytesConstRef m_data;
+	size_t m_position = 0;
+};
+
+}
+}
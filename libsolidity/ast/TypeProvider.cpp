@@ -20,10 +20,24 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/split.hpp>
 
+#include <mutex>
+
 using namespace std;
 using namespace dev;
 using namespace solidity;
 
+namespace
+{
+/// Guards the creation of types and the caches of the type provider, so that types can be
+/// requested by analysis passes running concurrently.
+/// It is recursive, because creating a type can request other types.
+recursive_mutex& typeProviderMutex()
+{
+	static recursive_mutex mutex;
+	return mutex;
+}
+}
+
 BoolType const TypeProvider::m_boolean{};
 InaccessibleDynamicType const TypeProvider::m_inaccessibleDynamic{};
 
@@ -174,6 +188,7 @@ inline void clearCaches(Container& container)
 
 void TypeProvider::reset()
 {
+	lock_guard<recursive_mutex> lock(typeProviderMutex());
 	clearCache(m_boolean);
 	clearCache(m_inaccessibleDynamic);
 	clearCache(m_bytesStorage);
@@ -189,6 +204,27 @@ void TypeProvider::reset()
 	clearCaches(instance().m_bytesM);
 	clearCaches(instance().m_magics);
 
+	instance().m_byteArrayTypes.clear();
+	instance().m_dynamicArrayTypes.clear();
+	instance().m_staticArrayTypes.clear();
+	instance().m_arraySliceTypes.clear();
+	instance().m_tupleTypes.clear();
+	instance().m_locationCopies.clear();
+	instance().m_functionDefinitionTypes.clear();
+	instance().m_accessorTypes.clear();
+	instance().m_eventTypes.clear();
+	instance().m_functionTypeNameTypes.clear();
+	instance().m_plainFunctionTypes.clear();
+	instance().m_functionTypes.clear();
+	instance().m_rationalNumberTypes.clear();
+	instance().m_contractTypes.clear();
+	instance().m_enumTypes.clear();
+	instance().m_moduleTypes.clear();
+	instance().m_typeTypes.clear();
+	instance().m_structTypes.clear();
+	instance().m_modifierTypes.clear();
+	instance().m_metaTypes.clear();
+	instance().m_mappingTypes.clear();
 	instance().m_generalTypes.clear();
 	instance().m_stringLiteralTypes.clear();
 	instance().m_ufixedMxN.clear();
@@ -198,10 +234,24 @@ void TypeProvider::reset()
 template <typename T, typename... Args>
 inline T const* TypeProvider::createAndGet(Args&& ... _args)
 {
+	lock_guard<recursive_mutex> lock(typeProviderMutex());
 	instance().m_generalTypes.emplace_back(make_unique<T>(std::forward<Args>(_args)...));
 	return static_cast<T const*>(instance().m_generalTypes.back().get());
 }
 
+template <typename T, typename Key, typename... Args>
+inline T const* TypeProvider::createAndGetCached(map<Key, T const*>& _cache, Key const& _key, Args&& ... _args)
+{
+	lock_guard<recursive_mutex> lock(typeProviderMutex());
+	auto it = _cache.find(_key);
+	if (it != _cache.end())
+		return it->second;
+	// Creating the type can create other types, so the cache is only modified afterwards.
+	T const* type = createAndGet<T>(std::forward<Args>(_args)...);
+	_cache.emplace(_key, type);
+	return type;
+}
+
 Type const* TypeProvider::fromElementaryTypeName(ElementaryTypeNameToken const& _type, std::optional<StateMutability> _stateMutability)
 {
 	solAssert(
@@ -304,6 +354,7 @@ TypePointer TypeProvider::fromElementaryTypeName(string const& _name)
 
 ArrayType const* TypeProvider::bytesStorage()
 {
+	lock_guard<recursive_mutex> lock(typeProviderMutex());
 	if (!m_bytesStorage)
 		m_bytesStorage = make_unique<ArrayType>(DataLocation::Storage, false);
 	return m_bytesStorage.get();
@@ -311,6 +362,7 @@ ArrayType const* TypeProvider::bytesStorage()
 
 ArrayType const* TypeProvider::bytesMemory()
 {
+	lock_guard<recursive_mutex> lock(typeProviderMutex());
 	if (!m_bytesMemory)
 		m_bytesMemory = make_unique<ArrayType>(DataLocation::Memory, false);
 	return m_bytesMemory.get();
@@ -318,6 +370,7 @@ ArrayType const* TypeProvider::bytesMemory()
 
 ArrayType const* TypeProvider::bytesCalldata()
 {
+	lock_guard<recursive_mutex> lock(typeProviderMutex());
 	if (!m_bytesCalldata)
 		m_bytesCalldata = make_unique<ArrayType>(DataLocation::CallData, false);
 	return m_bytesCalldata.get();
@@ -325,6 +378,7 @@ ArrayType const* TypeProvider::bytesCalldata()
 
 ArrayType const* TypeProvider::stringStorage()
 {
+	lock_guard<recursive_mutex> lock(typeProviderMutex());
 	if (!m_stringStorage)
 		m_stringStorage = make_unique<ArrayType>(DataLocation::Storage, true);
 	return m_stringStorage.get();
@@ -332,6 +386,7 @@ ArrayType const* TypeProvider::stringStorage()
 
 ArrayType const* TypeProvider::stringMemory()
 {
+	lock_guard<recursive_mutex> lock(typeProviderMutex());
 	if (!m_stringMemory)
 		m_stringMemory = make_unique<ArrayType>(DataLocation::Memory, true);
 	return m_stringMemory.get();
@@ -375,6 +430,7 @@ RationalNumberType const* TypeProvider::rationalNumber(Literal const& _literal)
 
 StringLiteralType const* TypeProvider::stringLiteral(string const& literal)
 {
+	lock_guard<recursive_mutex> lock(typeProviderMutex());
 	auto i = instance().m_stringLiteralTypes.find(literal);
 	if (i != instance().m_stringLiteralTypes.end())
 		return i->second.get();
@@ -384,6 +440,7 @@ StringLiteralType const* TypeProvider::stringLiteral(string const& literal)
 
 FixedPointType const* TypeProvider::fixedPoint(unsigned m, unsigned n, FixedPointType::Modifier _modifier)
 {
+	lock_guard<recursive_mutex> lock(typeProviderMutex());
 	auto& map = _modifier == FixedPointType::Modifier::Unsigned ? instance().m_ufixedMxN : instance().m_fixedMxN;
 
 	auto i = map.find(make_pair(m, n));
@@ -401,7 +458,7 @@ TupleType const* TypeProvider::tuple(vector<Type const*> members)
 	if (members.empty())
 		return &m_emptyTuple;
 
-	return createAndGet<TupleType>(move(members));
+	return createAndGetCached(instance().m_tupleTypes, members, members);
 }
 
 ReferenceType const* TypeProvider::withLocation(ReferenceType const* _type, DataLocation _location, bool _isPointer)
@@ -409,28 +466,36 @@ ReferenceType const* TypeProvider::withLocation(ReferenceType const* _type, Data
 	if (_type->location() == _location && _type->isPointer() == _isPointer)
 		return _type;
 
+	lock_guard<recursive_mutex> lock(typeProviderMutex());
+	auto key = make_tuple(_type, _location, _isPointer);
+	auto it = instance().m_locationCopies.find(key);
+	if (it != instance().m_locationCopies.end())
+		return it->second;
+
 	instance().m_generalTypes.emplace_back(_type->copyForLocation(_location, _isPointer));
-	return static_cast<ReferenceType const*>(instance().m_generalTypes.back().get());
+	auto copy = static_cast<ReferenceType const*>(instance().m_generalTypes.back().get());
+	instance().m_locationCopies.emplace(key, copy);
+	return copy;
 }
 
 FunctionType const* TypeProvider::function(FunctionDefinition const& _function, bool _isInternal)
 {
-	return createAndGet<FunctionType>(_function, _isInternal);
+	return createAndGetCached(instance().m_functionDefinitionTypes, make_pair(&_function, _isInternal), _function, _isInternal);
 }
 
 FunctionType const* TypeProvider::function(VariableDeclaration const& _varDecl)
 {
-	return createAndGet<FunctionType>(_varDecl);
+	return createAndGetCached(instance().m_accessorTypes, &_varDecl, _varDecl);
 }
 
 FunctionType const* TypeProvider::function(EventDefinition const& _def)
 {
-	return createAndGet<FunctionType>(_def);
+	return createAndGetCached(instance().m_eventTypes, &_def, _def);
 }
 
 FunctionType const* TypeProvider::function(FunctionTypeName const& _typeName)
 {
-	return createAndGet<FunctionType>(_typeName);
+	return createAndGetCached(instance().m_functionTypeNameTypes, &_typeName, _typeName);
 }
 
 FunctionType const* TypeProvider::function(
@@ -441,7 +506,9 @@ FunctionType const* TypeProvider::function(
 	StateMutability _stateMutability
 )
 {
-	return createAndGet<FunctionType>(
+	return createAndGetCached(
+		instance().m_plainFunctionTypes,
+		make_tuple(_parameterTypes, _returnParameterTypes, _kind, _arbitraryParameters, _stateMutability),
 		_parameterTypes, _returnParameterTypes,
 		_kind, _arbitraryParameters, _stateMutability
 	);
@@ -461,7 +528,21 @@ FunctionType const* TypeProvider::function(
 	bool _bound
 )
 {
-	return createAndGet<FunctionType>(
+	return createAndGetCached(
+		instance().m_functionTypes,
+		make_tuple(
+			_parameterTypes,
+			_returnParameterTypes,
+			_parameterNames,
+			_returnParameterNames,
+			_kind,
+			_arbitraryParameters,
+			_stateMutability,
+			_declaration,
+			_gasSet,
+			_valueSet,
+			_bound
+		),
 		_parameterTypes,
 		_returnParameterTypes,
 		_parameterNames,
@@ -478,7 +559,7 @@ FunctionType const* TypeProvider::function(
 
 RationalNumberType const* TypeProvider::rationalNumber(rational const& _value, Type const* _compatibleBytesType)
 {
-	return createAndGet<RationalNumberType>(_value, _compatibleBytesType);
+	return createAndGetCached(instance().m_rationalNumberTypes, make_pair(_value, _compatibleBytesType), _value, _compatibleBytesType);
 }
 
 ArrayType const* TypeProvider::array(DataLocation _location, bool _isString)
@@ -497,52 +578,52 @@ ArrayType const* TypeProvider::array(DataLocation _location, bool _isString)
 		if (_location == DataLocation::Memory)
 			return bytesMemory();
 	}
-	return createAndGet<ArrayType>(_location, _isString);
+	return createAndGetCached(instance().m_byteArrayTypes, make_pair(_location, _isString), _location, _isString);
 }
 
 ArrayType const* TypeProvider::array(DataLocation _location, Type const* _baseType)
 {
-	return createAndGet<ArrayType>(_location, _baseType);
+	return createAndGetCached(instance().m_dynamicArrayTypes, make_pair(_location, _baseType), _location, _baseType);
 }
 
 ArrayType const* TypeProvider::array(DataLocation _location, Type const* _baseType, u256 const& _length)
 {
-	return createAndGet<ArrayType>(_location, _baseType, _length);
+	return createAndGetCached(instance().m_staticArrayTypes, make_tuple(_location, _baseType, _length), _location, _baseType, _length);
 }
 
 ArraySliceType const* TypeProvider::arraySlice(ArrayType const& _arrayType)
 {
-	return createAndGet<ArraySliceType>(_arrayType);
+	return createAndGetCached(instance().m_arraySliceTypes, &_arrayType, _arrayType);
 }
 
 ContractType const* TypeProvider::contract(ContractDefinition const& _contractDef, bool _isSuper)
 {
-	return createAndGet<ContractType>(_contractDef, _isSuper);
+	return createAndGetCached(instance().m_contractTypes, make_pair(&_contractDef, _isSuper), _contractDef, _isSuper);
 }
 
 EnumType const* TypeProvider::enumType(EnumDefinition const& _enumDef)
 {
-	return createAndGet<EnumType>(_enumDef);
+	return createAndGetCached(instance().m_enumTypes, &_enumDef, _enumDef);
 }
 
 ModuleType const* TypeProvider::module(SourceUnit const& _source)
 {
-	return createAndGet<ModuleType>(_source);
+	return createAndGetCached(instance().m_moduleTypes, &_source, _source);
 }
 
 TypeType const* TypeProvider::typeType(Type const* _actualType)
 {
-	return createAndGet<TypeType>(_actualType);
+	return createAndGetCached(instance().m_typeTypes, _actualType, _actualType);
 }
 
 StructType const* TypeProvider::structType(StructDefinition const& _struct, DataLocation _location)
 {
-	return createAndGet<StructType>(_struct, _location);
+	return createAndGetCached(instance().m_structTypes, make_pair(&_struct, _location), _struct, _location);
 }
 
 ModifierType const* TypeProvider::modifier(ModifierDefinition const& _def)
 {
-	return createAndGet<ModifierType>(_def);
+	return createAndGetCached(instance().m_modifierTypes, &_def, _def);
 }
 
 MagicType const* TypeProvider::magic(MagicType::Kind _kind)
@@ -554,10 +635,10 @@ MagicType const* TypeProvider::magic(MagicType::Kind _kind)
 MagicType const* TypeProvider::meta(Type const* _type)
 {
 	solAssert(_type && _type->category() == Type::Category::Contract, "Only contracts supported for now.");
-	return createAndGet<MagicType>(_type);
+	return createAndGetCached(instance().m_metaTypes, _type, _type);
 }
 
 MappingType const* TypeProvider::mapping(Type const* _keyType, Type const* _valueType)
 {
-	return createAndGet<MappingType>(_keyType, _valueType);
+	return createAndGetCached(instance().m_mappingTypes, make_pair(_keyType, _valueType), _keyType, _valueType);
 }
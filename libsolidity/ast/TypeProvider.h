@@ -23,6 +23,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <tuple>
 #include <utility>
 
 namespace dev
@@ -36,6 +37,11 @@ namespace solidity
  * This is the Solidity Compiler's type provider. Use it to request for types. The caller does
  * <b>not</b> own the types.
  *
+ * Composite types are only created once for the same arguments, so repeated requests
+ * return the same instance.
+ * Types can be requested concurrently, but the caches inside the types (e.g. their members)
+ * are not synchronised.
+ *
  * It is not recommended to explicitly instantiate types unless you really know what and why
  * you are doing it.
  */
@@ -201,6 +207,11 @@ private:
 	template <typename T, typename... Args>
 	static inline T const* createAndGet(Args&& ... _args);
 
+	/// @returns the type stored in @a _cache under @a _key, creating it from @a _args first
+	/// if it does not exist yet. This ensures that the type is only created once.
+	template <typename T, typename Key, typename... Args>
+	static inline T const* createAndGetCached(std::map<Key, T const*>& _cache, Key const& _key, Args&& ... _args);
+
 	static BoolType const m_boolean;
 	static InaccessibleDynamicType const m_inaccessibleDynamic;
 
@@ -223,6 +234,35 @@ private:
 	std::map<std::pair<unsigned, unsigned>, std::unique_ptr<FixedPointType>> m_fixedMxN{};
 	std::map<std::string, std::unique_ptr<StringLiteralType>> m_stringLiteralTypes{};
 	std::vector<std::unique_ptr<Type>> m_generalTypes{};
+
+	/// Caches of the types in m_generalTypes, such that structurally equal types share a single
+	/// instance (and thus their lazily computed members, interface types and storage layouts).
+	using FunctionTypeKey = std::tuple<
+		TypePointers, TypePointers, strings, strings, FunctionType::Kind, bool,
+		StateMutability, Declaration const*, bool, bool, bool
+	>;
+	using PlainFunctionTypeKey = std::tuple<strings, strings, FunctionType::Kind, bool, StateMutability>;
+	std::map<std::pair<DataLocation, bool>, ArrayType const*> m_byteArrayTypes{};
+	std::map<std::pair<DataLocation, Type const*>, ArrayType const*> m_dynamicArrayTypes{};
+	std::map<std::tuple<DataLocation, Type const*, u256>, ArrayType const*> m_staticArrayTypes{};
+	std::map<ArrayType const*, ArraySliceType const*> m_arraySliceTypes{};
+	std::map<std::vector<Type const*>, TupleType const*> m_tupleTypes{};
+	std::map<std::tuple<ReferenceType const*, DataLocation, bool>, ReferenceType const*> m_locationCopies{};
+	std::map<std::pair<FunctionDefinition const*, bool>, FunctionType const*> m_functionDefinitionTypes{};
+	std::map<VariableDeclaration const*, FunctionType const*> m_accessorTypes{};
+	std::map<EventDefinition const*, FunctionType const*> m_eventTypes{};
+	std::map<FunctionTypeName const*, FunctionType const*> m_functionTypeNameTypes{};
+	std::map<PlainFunctionTypeKey, FunctionType const*> m_plainFunctionTypes{};
+	std::map<FunctionTypeKey, FunctionType const*> m_functionTypes{};
+	std::map<std::pair<rational, Type const*>, RationalNumberType const*> m_rationalNumberTypes{};
+	std::map<std::pair<ContractDefinition const*, bool>, ContractType const*> m_contractTypes{};
+	std::map<EnumDefinition const*, EnumType const*> m_enumTypes{};
+	std::map<SourceUnit const*, ModuleType const*> m_moduleTypes{};
+	std::map<Type const*, TypeType const*> m_typeTypes{};
+	std::map<std::pair<StructDefinition const*, DataLocation>, StructType const*> m_structTypes{};
+	std::map<ModifierDefinition const*, ModifierType const*> m_modifierTypes{};
+	std::map<Type const*, MagicType const*> m_metaTypes{};
+	std::map<std::pair<Type const*, Type const*>, MappingType const*> m_mappingTypes{};
 };
 
 } // namespace solidity
@@ -30,6 +30,7 @@
 
 #include <libevmasm/Instruction.h>
 #include <liblangutil/Exceptions.h>
+#include <libdevcore/Whiskers.h>
 
 using namespace std;
 using namespace dev;
@@ -57,6 +58,17 @@ void ArrayUtils::copyArrayToStorage(ArrayType const& _targetType, ArrayType cons
 	bool haveByteOffsetSource = !directCopy && sourceIsStorage && sourceBaseType->storageBytes() <= 16;
 	bool haveByteOffsetTarget = !directCopy && targetBaseType->storageBytes() <= 16;
 	unsigned byteOffsetSize = (haveByteOffsetSource ? 1 : 0) + (haveByteOffsetTarget ? 1 : 0);
+	// Packed value types from memory or calldata are collected into full slots on the stack,
+	// so that each target slot is written exactly once.
+	bool packedCopy =
+		!sourceIsStorage &&
+		haveByteOffsetTarget &&
+		*sourceBaseType == *targetBaseType &&
+		(
+			sourceBaseType->category() == Type::Category::Integer ||
+			sourceBaseType->category() == Type::Category::FixedBytes ||
+			sourceBaseType->category() == Type::Category::Bool
+		);
 
 	// stack: source_ref [source_length] target_ref
 	// store target_ref
@@ -160,133 +172,192 @@ void ArrayUtils::copyArrayToStorage(ArrayType const& _targetType, ArrayType cons
 			_context << Instruction::DUP3 << Instruction::ISZERO;
 			_context.appendConditionalJumpTo(copyLoopEndWithoutByteOffset);
 
-			if (_sourceType.location() == DataLocation::Storage && _sourceType.isDynamicallySized())
-				CompilerUtils(_context).computeHashStatic();
-			// stack: target_ref target_data_end source_length target_data_pos source_data_pos
-			_context << Instruction::SWAP2;
-			utils.convertLengthToSize(_sourceType);
-			_context << Instruction::DUP3 << Instruction::ADD;
-			// stack: target_ref target_data_end source_data_pos target_data_pos source_data_end
-			if (haveByteOffsetTarget)
-				_context << u256(0);
-			if (haveByteOffsetSource)
-				_context << u256(0);
-			// stack: target_ref target_data_end source_data_pos target_data_pos source_data_end [target_byte_offset] [source_byte_offset]
-			eth::AssemblyItem copyLoopStart = _context.newTag();
-			_context << copyLoopStart;
-			// check for loop condition
-			_context
-				<< dupInstruction(3 + byteOffsetSize) << dupInstruction(2 + byteOffsetSize)
-				<< Instruction::GT << Instruction::ISZERO;
-			eth::AssemblyItem copyLoopEnd = _context.appendConditionalJump();
-			// stack: target_ref target_data_end source_data_pos target_data_pos source_data_end [target_byte_offset] [source_byte_offset]
-			// copy
-			if (sourceBaseType->category() == Type::Category::Array)
-			{
-				solAssert(byteOffsetSize == 0, "Byte offset for array as base type.");
-				auto const& sourceBaseArrayType = dynamic_cast<ArrayType const&>(*sourceBaseType);
-				_context << Instruction::DUP3;
-				if (sourceBaseArrayType.location() == DataLocation::Memory)
-					_context << Instruction::MLOAD;
-				_context << Instruction::DUP3;
-				utils.copyArrayToStorage(dynamic_cast<ArrayType const&>(*targetBaseType), sourceBaseArrayType);
-				_context << Instruction::POP;
-			}
-			else if (directCopy)
-			{
-				solAssert(byteOffsetSize == 0, "Byte offset for direct copy.");
-				_context
-					<< Instruction::DUP3 << Instruction::SLOAD
-					<< Instruction::DUP3 << Instruction::SSTORE;
-			}
+			if (packedCopy)
+				// stack: target_ref target_data_end source_length target_data_pos source_data_pos
+				utils.copyPackedValuesToStorage(_sourceType, *targetBaseType);
 			else
 			{
-				// Note that we have to copy each element on its own in case conversion is involved.
-				// We might copy too much if there is padding at the last element, but this way end
-				// checking is easier.
+				if (_sourceType.location() == DataLocation::Storage && _sourceType.isDynamicallySized())
+					CompilerUtils(_context).computeHashStatic();
+				// stack: target_ref target_data_end source_length target_data_pos source_data_pos
+				_context << Instruction::SWAP2;
+				utils.convertLengthToSize(_sourceType);
+				_context << Instruction::DUP3 << Instruction::ADD;
+				// stack: target_ref target_data_end source_data_pos target_data_pos source_data_end
+				if (haveByteOffsetTarget)
+					_context << u256(0);
+				if (haveByteOffsetSource)
+					_context << u256(0);
 				// stack: target_ref target_data_end source_data_pos target_data_pos source_data_end [target_byte_offset] [source_byte_offset]
-				_context << dupInstruction(3 + byteOffsetSize);
-				if (_sourceType.location() == DataLocation::Storage)
+				eth::AssemblyItem copyLoopStart = _context.newTag();
+				_context << copyLoopStart;
+				// check for loop condition
+				_context
+					<< dupInstruction(3 + byteOffsetSize) << dupInstruction(2 + byteOffsetSize)
+					<< Instruction::GT << Instruction::ISZERO;
+				eth::AssemblyItem copyLoopEnd = _context.appendConditionalJump();
+				// stack: target_ref target_data_end source_data_pos target_data_pos source_data_end [target_byte_offset] [source_byte_offset]
+				// copy
+				if (sourceBaseType->category() == Type::Category::Array)
 				{
-					if (haveByteOffsetSource)
-						_context << Instruction::DUP2;
+					solAssert(byteOffsetSize == 0, "Byte offset for array as base type.");
+					auto const& sourceBaseArrayType = dynamic_cast<ArrayType const&>(*sourceBaseType);
+					_context << Instruction::DUP3;
+					if (sourceBaseArrayType.location() == DataLocation::Memory)
+						_context << Instruction::MLOAD;
+					_context << Instruction::DUP3;
+					utils.copyArrayToStorage(dynamic_cast<ArrayType const&>(*targetBaseType), sourceBaseArrayType);
+					_context << Instruction::POP;
+				}
+				else if (directCopy)
+				{
+					solAssert(byteOffsetSize == 0, "Byte offset for direct copy.");
+					_context
+						<< Instruction::DUP3 << Instruction::SLOAD
+						<< Instruction::DUP3 << Instruction::SSTORE;
+				}
+				else
+				{
+					// Note that we have to copy each element on its own in case conversion is involved.
+					// We might copy too much if there is padding at the last element, but this way end
+					// checking is easier.
+					// stack: target_ref target_data_end source_data_pos target_data_pos source_data_end [target_byte_offset] [source_byte_offset]
+					_context << dupInstruction(3 + byteOffsetSize);
+					if (_sourceType.location() == DataLocation::Storage)
+					{
+						if (haveByteOffsetSource)
+							_context << Instruction::DUP2;
+						else
+							_context << u256(0);
+						StorageItem(_context, *sourceBaseType).retrieveValue(SourceLocation(), true);
+					}
+					else if (sourceBaseType->isValueType())
+						CompilerUtils(_context).loadFromMemoryDynamic(*sourceBaseType, fromCalldata, true, false);
+					else
+						solUnimplemented("Copying of type " + _sourceType.toString(false) + " to storage not yet supported.");
+					// stack: target_ref target_data_end source_data_pos target_data_pos source_data_end [target_byte_offset] [source_byte_offset] <source_value>...
+					solAssert(
+						2 + byteOffsetSize + sourceBaseType->sizeOnStack() <= 16,
+						"Stack too deep, try removing local variables."
+					);
+					// fetch target storage reference
+					_context << dupInstruction(2 + byteOffsetSize + sourceBaseType->sizeOnStack());
+					if (haveByteOffsetTarget)
+						_context << dupInstruction(1 + byteOffsetSize + sourceBaseType->sizeOnStack());
 					else
 						_context << u256(0);
-					StorageItem(_context, *sourceBaseType).retrieveValue(SourceLocation(), true);
+					StorageItem(_context, *targetBaseType).storeValue(*sourceBaseType, SourceLocation(), true);
 				}
-				else if (sourceBaseType->isValueType())
-					CompilerUtils(_context).loadFromMemoryDynamic(*sourceBaseType, fromCalldata, true, false);
+				// stack: target_ref target_data_end source_data_pos target_data_pos source_data_end [target_byte_offset] [source_byte_offset]
+				// increment source
+				if (haveByteOffsetSource)
+					utils.incrementByteOffset(sourceBaseType->storageBytes(), 1, haveByteOffsetTarget ? 5 : 4);
 				else
-					solUnimplemented("Copying of type " + _sourceType.toString(false) + " to storage not yet supported.");
-				// stack: target_ref target_data_end source_data_pos target_data_pos source_data_end [target_byte_offset] [source_byte_offset] <source_value>...
-				solAssert(
-					2 + byteOffsetSize + sourceBaseType->sizeOnStack() <= 16,
-					"Stack too deep, try removing local variables."
-				);
-				// fetch target storage reference
-				_context << dupInstruction(2 + byteOffsetSize + sourceBaseType->sizeOnStack());
+				{
+					_context << swapInstruction(2 + byteOffsetSize);
+					if (sourceIsStorage)
+						_context << sourceBaseType->storageSize();
+					else if (_sourceType.location() == DataLocation::Memory)
+						_context << sourceBaseType->memoryHeadSize();
+					else
+						_context << sourceBaseType->calldataHeadSize();
+					_context
+						<< Instruction::ADD
+						<< swapInstruction(2 + byteOffsetSize);
+				}
+				// increment target
 				if (haveByteOffsetTarget)
-					_context << dupInstruction(1 + byteOffsetSize + sourceBaseType->sizeOnStack());
-				else
-					_context << u256(0);
-				StorageItem(_context, *targetBaseType).storeValue(*sourceBaseType, SourceLocation(), true);
-			}
-			// stack: target_ref target_data_end source_data_pos target_data_pos source_data_end [target_byte_offset] [source_byte_offset]
-			// increment source
-			if (haveByteOffsetSource)
-				utils.incrementByteOffset(sourceBaseType->storageBytes(), 1, haveByteOffsetTarget ? 5 : 4);
-			else
-			{
-				_context << swapInstruction(2 + byteOffsetSize);
-				if (sourceIsStorage)
-					_context << sourceBaseType->storageSize();
-				else if (_sourceType.location() == DataLocation::Memory)
-					_context << sourceBaseType->memoryHeadSize();
+					utils.incrementByteOffset(targetBaseType->storageBytes(), byteOffsetSize, byteOffsetSize + 2);
 				else
-					_context << sourceBaseType->calldataHeadSize();
-				_context
-					<< Instruction::ADD
-					<< swapInstruction(2 + byteOffsetSize);
-			}
-			// increment target
-			if (haveByteOffsetTarget)
-				utils.incrementByteOffset(targetBaseType->storageBytes(), byteOffsetSize, byteOffsetSize + 2);
-			else
-				_context
-					<< swapInstruction(1 + byteOffsetSize)
-					<< targetBaseType->storageSize()
-					<< Instruction::ADD
-					<< swapInstruction(1 + byteOffsetSize);
-			_context.appendJumpTo(copyLoopStart);
-			_context << copyLoopEnd;
-			if (haveByteOffsetTarget)
-			{
-				// clear elements that might be left over in the current slot in target
-				// stack: target_ref target_data_end source_data_pos target_data_pos source_data_end target_byte_offset [source_byte_offset]
-				_context << dupInstruction(byteOffsetSize) << Instruction::ISZERO;
-				eth::AssemblyItem copyCleanupLoopEnd = _context.appendConditionalJump();
-				_context << dupInstruction(2 + byteOffsetSize) << dupInstruction(1 + byteOffsetSize);
-				StorageItem(_context, *targetBaseType).setToZero(SourceLocation(), true);
-				utils.incrementByteOffset(targetBaseType->storageBytes(), byteOffsetSize, byteOffsetSize + 2);
-				_context.appendJumpTo(copyLoopEnd);
-
-				_context << copyCleanupLoopEnd;
-				_context << Instruction::POP; // might pop the source, but then target is popped next
+					_context
+						<< swapInstruction(1 + byteOffsetSize)
+						<< targetBaseType->storageSize()
+						<< Instruction::ADD
+						<< swapInstruction(1 + byteOffsetSize);
+				_context.appendJumpTo(copyLoopStart);
+				_context << copyLoopEnd;
+				if (haveByteOffsetTarget)
+				{
+					// clear elements that might be left over in the current slot in target
+					// stack: target_ref target_data_end source_data_pos target_data_pos source_data_end target_byte_offset [source_byte_offset]
+					_context << dupInstruction(byteOffsetSize) << Instruction::ISZERO;
+					eth::AssemblyItem copyCleanupLoopEnd = _context.appendConditionalJump();
+					_context << dupInstruction(2 + byteOffsetSize) << dupInstruction(1 + byteOffsetSize);
+					StorageItem(_context, *targetBaseType).setToZero(SourceLocation(), true);
+					utils.incrementByteOffset(targetBaseType->storageBytes(), byteOffsetSize, byteOffsetSize + 2);
+					_context.appendJumpTo(copyLoopEnd);
+
+					_context << copyCleanupLoopEnd;
+					_context << Instruction::POP; // might pop the source, but then target is popped next
+				}
+				if (haveByteOffsetSource)
+					_context << Instruction::POP;
 			}
-			if (haveByteOffsetSource)
-				_context << Instruction::POP;
 			_context << copyLoopEndWithoutByteOffset;
 
 			// zero-out leftovers in target
 			// stack: target_ref target_data_end source_data_pos target_data_pos_updated source_data_end
 			_context << Instruction::POP << Instruction::SWAP1 << Instruction::POP;
 			// stack: target_ref target_data_end target_data_pos_updated
-			utils.clearStorageLoop(targetBaseType);
+			// Remaining slots are cleared as a whole, a partially used slot has already been
+			// cleaned up above.
+			utils.clearStorageLoop(targetBaseType->storageBytes() < 32 ? uint256 : targetBaseType);
 			_context << Instruction::POP;
 		}
 	);
 }
 
+void ArrayUtils::copyPackedValuesToStorage(ArrayType const& _sourceType, Type const& _baseType) const
+{
+	solAssert(_sourceType.location() != DataLocation::Storage, "");
+	solAssert(_baseType.isValueType() && _baseType.storageBytes() <= 16, "");
+
+	unsigned storageBytes = _baseType.storageBytes();
+	// Converts a word loaded from memory or calldata to the right-aligned storage representation.
+	string storageValue;
+	if (_baseType.category() == Type::Category::FixedBytes)
+		storageValue = m_context.evmVersion().hasBitwiseShifting() ?
+			"shr(" + to_string(256 - 8 * storageBytes) + ", value)" :
+			"div(value, " + formatNumber(u256(1) << (256 - 8 * storageBytes)) + ")";
+	else if (_baseType.category() == Type::Category::Bool)
+		storageValue = "iszero(iszero(value))";
+	else
+	{
+		solAssert(_baseType.category() == Type::Category::Integer, "");
+		storageValue = "and(value, " + formatNumber((u256(1) << (8 * storageBytes)) - 1) + ")";
+	}
+
+	m_context.appendInlineAssembly(
+		Whiskers(R"({
+			let end := add(src, mul(len, <stride>))
+			for { } lt(src, end) { slot := add(slot, 1) }
+			{
+				let data := 0
+				let factor := 1
+				for { let i := 0 } and(lt(i, <itemsPerSlot>), lt(src, end)) { i := add(i, 1) }
+				{
+					let value := <load>(src)
+					data := or(data, mul(<storageValue>, factor))
+					factor := mul(factor, <factorIncrement>)
+					src := add(src, <stride>)
+				}
+				sstore(slot, data)
+			}
+		})")
+		("stride", to_string(
+			_sourceType.location() == DataLocation::CallData ?
+			_baseType.calldataHeadSize() :
+			_baseType.memoryHeadSize()
+		))
+		("itemsPerSlot", to_string(32 / storageBytes))
+		("load", _sourceType.location() == DataLocation::CallData ? "calldataload" : "mload")
+		("storageValue", storageValue)
+		("factorIncrement", formatNumber(u256(1) << (8 * storageBytes)))
+		.render(),
+		{"len", "slot", "src"}
+	);
+}
+
 void ArrayUtils::copyArrayToMemory(ArrayType const& _sourceType, bool _padToWordBoundaries) const
 {
 	solUnimplementedAssert(
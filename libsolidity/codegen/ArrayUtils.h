@@ -110,6 +110,12 @@ public:
 	void accessCallDataArrayElement(ArrayType const& _arrayType, bool _doBoundsCheck = true) const;
 
 private:
+	/// Copies the elements of a memory or calldata array of packed value types to consecutive
+	/// storage slots. The elements of each slot are combined on the stack, so that every slot
+	/// is written by a single SSTORE. Unused bytes in the last slot are zeroed.
+	/// Stack pre: length target_data_pos source_data_pos
+	/// Stack post: length target_data_pos_updated source_data_end
+	void copyPackedValuesToStorage(ArrayType const& _sourceType, Type const& _baseType) const;
 	/// Adds the given number of bytes to a storage byte offset counter and also increments
 	/// the storage offset if adding this number again would increase the counter over 32.
 	/// @param byteOffsetPosition the stack offset of the storage byte offset
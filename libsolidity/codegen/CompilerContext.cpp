@@ -207,14 +207,22 @@ FunctionDefinition const& CompilerContext::resolveVirtualFunction(FunctionDefini
 	if (auto scope = dynamic_cast<ContractDefinition const*>(_function.scope()))
 		if (scope->isLibrary())
 			return _function;
-	solAssert(!m_inheritanceHierarchy.empty(), "No inheritance hierarchy set.");
-	return resolveVirtualFunction(_function, m_inheritanceHierarchy.begin());
+	solAssert(m_virtualFunctionTable, "No inheritance hierarchy set.");
+	return m_virtualFunctionTable->resolve(_function);
 }
 
 FunctionDefinition const& CompilerContext::superFunction(FunctionDefinition const& _function, ContractDefinition const& _base)
 {
-	solAssert(!m_inheritanceHierarchy.empty(), "No inheritance hierarchy set.");
-	return resolveVirtualFunction(_function, superContract(_base));
+	solAssert(m_virtualFunctionTable, "No inheritance hierarchy set.");
+	return m_virtualFunctionTable->resolveSuper(_function, _base);
+}
+
+void CompilerContext::setInheritanceHierarchy(vector<ContractDefinition const*> const& _hierarchy)
+{
+	solAssert(!_hierarchy.empty(), "");
+	solAssert(_hierarchy == _hierarchy.front()->annotation().linearizedBaseContracts, "");
+	m_inheritanceHierarchy = _hierarchy;
+	m_virtualFunctionTable = make_unique<VirtualFunctionTable>(*_hierarchy.front());
 }
 
 FunctionDefinition const* CompilerContext::nextConstructor(ContractDefinition const& _contract) const
@@ -460,26 +468,6 @@ void CompilerContext::appendInlineAssembly(
 	updateSourceLocation();
 }
 
-FunctionDefinition const& CompilerContext::resolveVirtualFunction(
-	FunctionDefinition const& _function,
-	vector<ContractDefinition const*>::const_iterator _searchStart
-)
-{
-	string name = _function.name();
-	FunctionType functionType(_function);
-	auto it = _searchStart;
-	for (; it != m_inheritanceHierarchy.end(); ++it)
-		for (FunctionDefinition const* function: (*it)->definedFunctions())
-			if (
-				function->name() == name &&
-				!function->isConstructor() &&
-				FunctionType(*function).asCallableFunction(false)->hasEqualParameterTypes(functionType)
-			)
-				return *function;
-	solAssert(false, "Super function " + name + " not found.");
-	return _function; // not reached
-}
-
 vector<ContractDefinition const*>::const_iterator CompilerContext::superContract(ContractDefinition const& _contract) const
 {
 	solAssert(!m_inheritanceHierarchy.empty(), "No inheritance hierarchy set.");
@@ -26,6 +26,7 @@
 #include <libsolidity/ast/ASTForward.h>
 #include <libsolidity/ast/Types.h>
 #include <libsolidity/codegen/ABIFunctions.h>
+#include <libsolidity/codegen/VirtualFunctionTable.h>
 
 #include <libsolidity/interface/OptimiserSettings.h>
 
@@ -100,8 +101,9 @@ public:
 	FunctionDefinition const& superFunction(FunctionDefinition const& _function, ContractDefinition const& _base);
 	/// @returns the next constructor in the inheritance hierarchy.
 	FunctionDefinition const* nextConstructor(ContractDefinition const& _contract) const;
-	/// Sets the current inheritance hierarchy from derived to base.
-	void setInheritanceHierarchy(std::vector<ContractDefinition const*> const& _hierarchy) { m_inheritanceHierarchy = _hierarchy; }
+	/// Sets the current inheritance hierarchy from derived to base, which has to be the list of
+	/// linearized base contracts of its first contract, and builds its virtual function table.
+	void setInheritanceHierarchy(std::vector<ContractDefinition const*> const& _hierarchy);
 
 	/// @returns the next function in the queue of functions that are still to be compiled
 	/// (i.e. that were referenced during compilation but where we did not yet generate code for).
@@ -265,12 +267,6 @@ public:
 	void setModifierDepth(size_t _modifierDepth) { m_asm->m_currentModifierDepth = _modifierDepth; }
 
 private:
-	/// Searches the inheritance hierarchy towards the base starting from @a _searchStart and returns
-	/// the first function definition that is overwritten by _function.
-	FunctionDefinition const& resolveVirtualFunction(
-		FunctionDefinition const& _function,
-		std::vector<ContractDefinition const*>::const_iterator _searchStart
-	);
 	/// @returns an iterator to the contract directly above the given contract.
 	std::vector<ContractDefinition const*>::const_iterator superContract(ContractDefinition const& _contract) const;
 	/// Updates source location set in the assembly.
@@ -326,6 +322,8 @@ private:
 	std::map<Declaration const*, std::vector<unsigned>> m_localVariables;
 	/// List of current inheritance hierarchy from derived to base.
 	std::vector<ContractDefinition const*> m_inheritanceHierarchy;
+	/// Virtual function table of the most derived contract of the inheritance hierarchy.
+	std::unique_ptr<VirtualFunctionTable> m_virtualFunctionTable;
 	/// Stack of current visited AST nodes, used for location attachment
 	std::stack<ASTNode const*> m_visitedNodes;
 	/// The runtime context if in Creation mode, this is used for generating tags that would be stored into the storage and then used at runtime.
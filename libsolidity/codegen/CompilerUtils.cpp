@@ -27,6 +27,7 @@
 #include <libsolidity/codegen/ABIFunctions.h>
 #include <libsolidity/codegen/ArrayUtils.h>
 #include <libsolidity/codegen/LValue.h>
+#include <libevmasm/GasMeter.h>
 #include <libevmasm/Instruction.h>
 #include <libdevcore/Whiskers.h>
 
@@ -625,13 +626,23 @@ void CompilerUtils::memoryCopy32()
 {
 	// Stack here: size target source
 
-	m_context.appendInlineAssembly(R"(
-		{
-			for { let i := 0 } lt(i, len) { i := add(i, 32) } {
-				mstore(add(dst, i), mload(add(src, i)))
+	m_context.appendInlineAssembly(
+		Whiskers(R"(
+			{
+				switch gt(len, <threshold>)
+				case 0 {
+					for { let i := 0 } lt(i, len) { i := add(i, 32) } {
+						mstore(add(dst, i), mload(add(src, i)))
+					}
+				}
+				default {
+					<bulkCopy>
+				}
 			}
-		}
-	)",
+		)")
+		("threshold", to_string(bulkMemoryCopyThreshold(m_context.evmVersion())))
+		("bulkCopy", bulkMemoryCopyCode(m_context.evmVersion(), "dst", "src", "len"))
+		.render(),
 		{ "len", "dst", "src" }
 	);
 	m_context << Instruction::POP << Instruction::POP << Instruction::POP;
@@ -641,31 +652,79 @@ void CompilerUtils::memoryCopy()
 {
 	// Stack here: size target source
 
-	m_context.appendInlineAssembly(R"(
-		{
-			// copy 32 bytes at once
-			for
-				{}
-				iszero(lt(len, 32))
-				{
-					dst := add(dst, 32)
-					src := add(src, 32)
-					len := sub(len, 32)
+	m_context.appendInlineAssembly(
+		Whiskers(R"(
+			{
+				switch gt(len, <threshold>)
+				case 0 {
+					// copy 32 bytes at once
+					for
+						{}
+						iszero(lt(len, 32))
+						{
+							dst := add(dst, 32)
+							src := add(src, 32)
+							len := sub(len, 32)
+						}
+						{ mstore(dst, mload(src)) }
+
+					// copy the remainder (0 < len < 32)
+					let mask := sub(exp(256, sub(32, len)), 1)
+					let srcpart := and(mload(src), not(mask))
+					let dstpart := and(mload(dst), mask)
+					mstore(dst, or(srcpart, dstpart))
 				}
-				{ mstore(dst, mload(src)) }
-
-			// copy the remainder (0 < len < 32)
-			let mask := sub(exp(256, sub(32, len)), 1)
-			let srcpart := and(mload(src), not(mask))
-			let dstpart := and(mload(dst), mask)
-			mstore(dst, or(srcpart, dstpart))
-		}
-	)",
+				default {
+					<bulkCopy>
+				}
+			}
+		)")
+		("threshold", to_string(bulkMemoryCopyThreshold(m_context.evmVersion())))
+		("bulkCopy", bulkMemoryCopyCode(m_context.evmVersion(), "dst", "src", "len"))
+		.render(),
 		{ "len", "dst", "src" }
 	);
 	m_context << Instruction::POP << Instruction::POP << Instruction::POP;
 }
 
+size_t CompilerUtils::bulkMemoryCopyThreshold(EVMVersion _evmVersion)
+{
+	solAssert(!_evmVersion.hasMemoryCopy(), "Native memory copy not yet implemented.");
+	// Approximate cost of one iteration of the copy loops above
+	// (loop condition, jump, mload, mstore and updating the offsets).
+	unsigned const loopWordGas = 50;
+	// Pushing the call arguments and checking the result.
+	unsigned const callSetupGas = 50;
+	unsigned const fixedGas = GasCosts::callGas(_evmVersion) + GasCosts::identityGas + callSetupGas;
+	unsigned const savedGasPerWord = loopWordGas - GasCosts::identityWordGas;
+	return 32 * ((fixedGas + savedGasPerWord - 1) / savedGasPerWord);
+}
+
+string CompilerUtils::bulkMemoryCopyCode(
+	EVMVersion _evmVersion,
+	string const& _target,
+	string const& _source,
+	string const& _length
+)
+{
+	solAssert(!_evmVersion.hasMemoryCopy(), "Native memory copy not yet implemented.");
+	// The identity precompile charges a fixed fee plus a fee per word, which we
+	// supply exactly, since older EVM versions do not allow requesting more gas than is left.
+	return Whiskers(R"(let <gas> := add(<baseGas>, mul(<wordGas>, div(add(<length>, 31), 32)))
+		if iszero(<call>(<gas>, 4, <?needsValue>0, </needsValue><source>, <length>, <target>, <length>)) {
+			invalid()
+		})")
+	("gas", _target + "_copy_gas")
+	("call", _evmVersion.hasStaticCall() ? "staticcall" : "call")
+	("needsValue", !_evmVersion.hasStaticCall())
+	("baseGas", to_string(GasCosts::identityGas))
+	("wordGas", to_string(GasCosts::identityWordGas))
+	("target", _target)
+	("source", _source)
+	("length", _length)
+	.render();
+}
+
 void CompilerUtils::splitExternalFunctionType(bool _leftAligned)
 {
 	// We have to split the left-aligned <address><function identifier> into two stack slots:
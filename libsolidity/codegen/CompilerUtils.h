@@ -194,15 +194,30 @@ public:
 
 	/// Copies full 32 byte words in memory (regions cannot overlap), i.e. may copy more than length.
 	/// Length can be zero, in this case, it copies nothing.
+	/// Switches to a bulk copy above bulkMemoryCopyThreshold().
 	/// Stack pre: <size> <target> <source>
 	/// Stack post:
 	void memoryCopy32();
 	/// Copies data in memory (regions cannot overlap).
 	/// Length can be zero, in this case, it copies nothing.
+	/// Switches to a bulk copy above bulkMemoryCopyThreshold().
 	/// Stack pre: <size> <target> <source>
 	/// Stack post:
 	void memoryCopy();
 
+	/// @returns the number of bytes above which copying memory in bulk is cheaper
+	/// than a loop that copies 32 bytes per iteration.
+	static size_t bulkMemoryCopyThreshold(langutil::EVMVersion _evmVersion);
+	/// @returns Yul code that copies exactly @a _length bytes from @a _source to @a _target
+	/// in memory (regions cannot overlap). The arguments have to be Yul identifiers.
+	/// Uses the identity precompile unless the EVM version has a native memory copy opcode.
+	static std::string bulkMemoryCopyCode(
+		langutil::EVMVersion _evmVersion,
+		std::string const& _target,
+		std::string const& _source,
+		std::string const& _length
+	);
+
 	/// Stores the given string in memory.
 	/// Stack pre: mempos
 	/// Stack post:
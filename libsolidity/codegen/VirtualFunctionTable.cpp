@@ -0,0 +1,76 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <libsolidity/codegen/VirtualFunctionTable.h>
+
+#include <libsolidity/analysis/OverrideChecker.h>
+#include <libsolidity/ast/AST.h>
+
+using namespace std;
+using namespace dev;
+using namespace dev::solidity;
+
+VirtualFunctionTable::VirtualFunctionTable(ContractDefinition const& _contract):
+	m_summary(InheritanceSummary::of(_contract))
+{
+	vector<ContractDefinition const*> const& bases = _contract.annotation().linearizedBaseContracts;
+	solAssert(!bases.empty() && bases.front() == &_contract, "Inheritance hierarchy not linearized.");
+
+	// All functions with the same signature share the list of implementations in the summary.
+	map<vector<FunctionDefinition const*> const*, size_t> slotIndexByImplementations;
+	for (ContractDefinition const* base: bases)
+		for (FunctionDefinition const* function: base->definedFunctions())
+		{
+			if (function->isConstructor())
+				continue;
+			vector<FunctionDefinition const*> const& implementations = m_summary.implementations(*function);
+			auto [it, inserted] = slotIndexByImplementations.emplace(&implementations, m_slots.size());
+			if (inserted)
+			{
+				// One entry per base position and a final entry for "above the last base".
+				vector<FunctionDefinition const*> slot(bases.size() + 1, nullptr);
+				for (FunctionDefinition const* implementation: implementations)
+					slot[m_summary.basePosition(dynamic_cast<ContractDefinition const&>(*implementation->scope()))] = implementation;
+				for (size_t position = bases.size(); position > 0; --position)
+					if (!slot[position - 1])
+						slot[position - 1] = slot[position];
+				m_slots.emplace_back(move(slot));
+			}
+			m_slotIndices[function] = it->second;
+		}
+}
+
+FunctionDefinition const& VirtualFunctionTable::resolve(FunctionDefinition const& _function) const
+{
+	FunctionDefinition const* function = slot(_function).front();
+	solAssert(function, "Function " + _function.name() + " not found.");
+	return *function;
+}
+
+FunctionDefinition const& VirtualFunctionTable::resolveSuper(FunctionDefinition const& _function, ContractDefinition const& _base) const
+{
+	FunctionDefinition const* function = slot(_function).at(m_summary.basePosition(_base) + 1);
+	solAssert(function, "Super function " + _function.name() + " not found.");
+	return *function;
+}
+
+vector<FunctionDefinition const*> const& VirtualFunctionTable::slot(FunctionDefinition const& _function) const
+{
+	auto it = m_slotIndices.find(&_function);
+	solAssert(it != m_slotIndices.end(), "Function " + _function.name() + " not found in inheritance hierarchy.");
+	return m_slots[it->second];
+}
@@ -0,0 +1,66 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Table of the functions internal calls to virtual functions resolve to.
+ */
+
+#pragma once
+
+#include <libsolidity/ast/ASTForward.h>
+
+#include <map>
+#include <vector>
+
+namespace dev
+{
+namespace solidity
+{
+
+class InheritanceSummary;
+
+/**
+ * Table of the functions that internal calls to the functions of a contract and its bases
+ * resolve to, built once before code generation.
+ * Every function (apart from constructors) gets a slot, which is shared by all functions
+ * with the same name and parameter types. For every position in the linearized base contracts,
+ * a slot holds the most derived implementation at or above that position.
+ */
+class VirtualFunctionTable
+{
+public:
+	/// Builds the table for @a _contract, whose base contracts have to be linearized.
+	explicit VirtualFunctionTable(ContractDefinition const& _contract);
+
+	/// @returns the most derived function overriding @a _function, which is @a _function
+	/// itself if it is not overridden.
+	FunctionDefinition const& resolve(FunctionDefinition const& _function) const;
+	/// @returns the function called via ``super`` by @a _function from @a _base, i.e. the
+	/// most derived implementation in the bases of the contract that come after @a _base.
+	FunctionDefinition const& resolveSuper(FunctionDefinition const& _function, ContractDefinition const& _base) const;
+
+private:
+	std::vector<FunctionDefinition const*> const& slot(FunctionDefinition const& _function) const;
+
+	InheritanceSummary const& m_summary;
+	/// Index of the slot of every function.
+	std::map<FunctionDefinition const*, size_t> m_slotIndices;
+	/// Implementation for every base position per slot, nullptr if there is none.
+	std::vector<std::vector<FunctionDefinition const*>> m_slots;
+};
+
+}
+}
@@ -89,19 +89,32 @@ string YulUtilFunctions::copyToMemoryFunction(bool _fromCalldata)
 		{
 			return Whiskers(R"(
 				function <functionName>(src, dst, length) {
-					let i := 0
-					for { } lt(i, length) { i := add(i, 32) }
-					{
-						mstore(add(dst, i), mload(add(src, i)))
+					switch gt(length, <bulkCopyThreshold>)
+					case 0 {
+						let i := 0
+						for { } lt(i, length) { i := add(i, 32) }
+						{
+							mstore(add(dst, i), mload(add(src, i)))
+						}
+						if gt(i, length)
+						{
+							// clear end
+							mstore(add(dst, length), 0)
+						}
 					}
-					if gt(i, length)
-					{
-						// clear end
-						mstore(add(dst, length), 0)
+					default {
+						<bulkCopy>
+						if and(length, 31)
+						{
+							// clear end
+							mstore(add(dst, length), 0)
+						}
 					}
 				}
 			)")
 			("functionName", functionName)
+			("bulkCopyThreshold", to_string(CompilerUtils::bulkMemoryCopyThreshold(m_evmVersion)))
+			("bulkCopy", CompilerUtils::bulkMemoryCopyCode(m_evmVersion, "dst", "src", "length"))
 			.render();
 		}
 	});
@@ -564,6 +577,8 @@ std::string YulUtilFunctions::resizeDynamicArrayFunction(ArrayType const& _type)
 
 	string functionName = "resize_array_" + _type.identifier();
 	return m_functionCollector->createFunction(functionName, [&]() {
+		unsigned storageBytes = _type.baseType()->storageBytes();
+		bool packed = storageBytes <= 16;
 		return Whiskers(R"(
 			function <functionName>(array, newLen) {
 				if gt(newLen, <maxArrayLength>) {
@@ -580,6 +595,15 @@ std::string YulUtilFunctions::resizeDynamicArrayFunction(ArrayType const& _type)
 					let oldSlotCount := <convertToSize>(oldLen)
 					let newSlotCount := <convertToSize>(newLen)
 					let arrayDataStart := <dataPosition>(array)
+					<?packed>
+					// Clear the unused part of the last slot that is still in use.
+					let usedItems := mod(newLen, <itemsPerSlot>)
+					if usedItems {
+						let lastSlot := add(arrayDataStart, sub(newSlotCount, 1))
+						let mask := sub(exp(0x100, mul(usedItems, <storageBytes>)), 1)
+						sstore(lastSlot, and(sload(lastSlot), mask))
+					}
+					</packed>
 					let deleteStart := add(arrayDataStart, newSlotCount)
 					let deleteEnd := add(arrayDataStart, oldSlotCount)
 					<clearStorageRange>(deleteStart, deleteEnd)
@@ -589,6 +613,9 @@ std::string YulUtilFunctions::resizeDynamicArrayFunction(ArrayType const& _type)
 			("fetchLength", arrayLengthFunction(_type))
 			("convertToSize", arrayConvertLengthToSize(_type))
 			("dataPosition", arrayDataAreaFunction(_type))
+			("packed", packed)
+			("itemsPerSlot", packed ? to_string(32 / storageBytes) : "")
+			("storageBytes", to_string(storageBytes))
 			("clearStorageRange", clearStorageRangeFunction(*_type.baseType()))
 			("maxArrayLength", (u256(1) << 64).str())
 			.render();
@@ -681,19 +708,22 @@ string YulUtilFunctions::clearStorageRangeFunction(Type const& _type)
 {
 	string functionName = "clear_storage_range_" + _type.identifier();
 
-	solAssert(_type.storageBytes() >= 32, "Expected smaller value for storage bytes");
+	if (_type.storageBytes() < 32)
+		solAssert(_type.isValueType(), "Invalid storage size for non-value type.");
 
 	return m_functionCollector->createFunction(functionName, [&]() {
+		// Slots of value types only contain values of that type, so they are cleared as a whole.
 		return Whiskers(R"(
 			function <functionName>(start, end) {
 				for {} lt(start, end) { start := add(start, <increment>) }
 				{
-					<setToZero>(start, 0)
+					<?valueType>sstore(start, 0)<!valueType><setToZero>(start, 0)</valueType>
 				}
 			}
 		)")
 		("functionName", functionName)
-		("setToZero", storageSetToZeroFunction(_type))
+		("valueType", _type.isValueType())
+		("setToZero", _type.isValueType() ? "" : storageSetToZeroFunction(_type))
 		("increment", _type.storageSize().str())
 		.render();
 	});
@@ -854,10 +884,9 @@ string YulUtilFunctions::arrayDataAreaFunction(ArrayType const& _type)
 
 string YulUtilFunctions::storageArrayIndexAccessFunction(ArrayType const& _type)
 {
-	solUnimplementedAssert(_type.baseType()->storageBytes() > 16, "");
-
 	string functionName = "storage_array_index_access_" + _type.identifier();
 	return m_functionCollector->createFunction(functionName, [&]() {
+		unsigned storageBytes = _type.baseType()->storageBytes();
 		return Whiskers(R"(
 			function <functionName>(array, index) -> slot, offset {
 				if iszero(lt(index, <arrayLen>(array))) {
@@ -866,7 +895,8 @@ string YulUtilFunctions::storageArrayIndexAccessFunction(ArrayType const& _type)
 
 				let data := <dataAreaFunc>(array)
 				<?multipleItemsPerSlot>
-
+					slot := add(data, div(index, <itemsPerSlot>))
+					offset := mul(mod(index, <itemsPerSlot>), <storageBytes>)
 				<!multipleItemsPerSlot>
 					slot := add(data, mul(index, <storageSize>))
 					offset := 0
@@ -876,7 +906,9 @@ string YulUtilFunctions::storageArrayIndexAccessFunction(ArrayType const& _type)
 		("functionName", functionName)
 		("arrayLen", arrayLengthFunction(_type))
 		("dataAreaFunc", arrayDataAreaFunction(_type))
-		("multipleItemsPerSlot", _type.baseType()->storageBytes() <= 16)
+		("multipleItemsPerSlot", storageBytes <= 16)
+		("itemsPerSlot", to_string(32 / storageBytes))
+		("storageBytes", to_string(storageBytes))
 		("storageSize", _type.baseType()->storageSize().str())
 		.render();
 	});
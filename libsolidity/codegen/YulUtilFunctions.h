@@ -135,6 +135,7 @@ public:
 
 	/// @returns the name of a function that will clear the storage area given
 	/// by the start and end (exclusive) parameters (slots).
+	/// For value types, including packed ones, whole slots are cleared.
 	/// signature: (start, end)
 	std::string clearStorageRangeFunction(Type const& _type);
 
@@ -70,21 +70,20 @@ string IRGenerationContext::functionName(VariableDeclaration const& _varDecl)
 	return "getter_fun_" + _varDecl.name() + "_" + to_string(_varDecl.id());
 }
 
+void IRGenerationContext::setInheritanceHierarchy(vector<ContractDefinition const*> _hierarchy)
+{
+	solAssert(!_hierarchy.empty(), "");
+	solAssert(_hierarchy == _hierarchy.front()->annotation().linearizedBaseContracts, "");
+	m_virtualFunctionTable = make_unique<VirtualFunctionTable>(*_hierarchy.front());
+	m_inheritanceHierarchy = move(_hierarchy);
+}
+
 FunctionDefinition const& IRGenerationContext::virtualFunction(FunctionDefinition const& _function)
 {
 	// @TODO previously, we had to distinguish creation context and runtime context,
 	// but since we do not work with jump positions anymore, this should not be a problem, right?
-	string name = _function.name();
-	FunctionType functionType(_function);
-	for (auto const& contract: m_inheritanceHierarchy)
-		for (FunctionDefinition const* function: contract->definedFunctions())
-			if (
-				function->name() == name &&
-				!function->isConstructor() &&
-				FunctionType(*function).asCallableFunction(false)->hasEqualParameterTypes(functionType)
-			)
-				return *function;
-	solAssert(false, "Super function " + name + " not found.");
+	solAssert(m_virtualFunctionTable, "No inheritance hierarchy set.");
+	return m_virtualFunctionTable->resolve(_function);
 }
 
 string IRGenerationContext::virtualFunctionName(FunctionDefinition const& _functionDeclaration)
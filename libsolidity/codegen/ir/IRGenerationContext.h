@@ -23,6 +23,7 @@
 #include <libsolidity/interface/OptimiserSettings.h>
 
 #include <libsolidity/codegen/MultiUseYulFunctionCollector.h>
+#include <libsolidity/codegen/VirtualFunctionTable.h>
 
 #include <liblangutil/EVMVersion.h>
 
@@ -57,11 +58,9 @@ public:
 
 	std::shared_ptr<MultiUseYulFunctionCollector> functionCollector() const { return m_functions; }
 
-	/// Sets the current inheritance hierarchy from derived to base.
-	void setInheritanceHierarchy(std::vector<ContractDefinition const*> _hierarchy)
-	{
-		m_inheritanceHierarchy = std::move(_hierarchy);
-	}
+	/// Sets the current inheritance hierarchy from derived to base, which has to be the list of
+	/// linearized base contracts of its first contract, and builds its virtual function table.
+	void setInheritanceHierarchy(std::vector<ContractDefinition const*> _hierarchy);
 
 
 	std::string addLocalVariable(VariableDeclaration const& _varDecl);
@@ -99,6 +98,7 @@ private:
 	langutil::EVMVersion m_evmVersion;
 	OptimiserSettings m_optimiserSettings;
 	std::vector<ContractDefinition const*> m_inheritanceHierarchy;
+	std::unique_ptr<VirtualFunctionTable> m_virtualFunctionTable;
 	std::map<VariableDeclaration const*, std::string> m_localVariables;
 	/// Storage offsets of state variables
 	std::map<VariableDeclaration const*, std::pair<u256, unsigned>> m_stateVariables;
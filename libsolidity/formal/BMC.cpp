@@ -17,26 +17,60 @@
 
 #include <libsolidity/formal/BMC.h>
 
-#include <libsolidity/formal/SMTPortfolio.h>
 #include <libsolidity/formal/SymbolicTypes.h>
 
+#include <libdevcore/Parallel.h>
+
 #include <boost/algorithm/string/replace.hpp>
 
+#include <thread>
+#include <unordered_set>
+
 using namespace std;
 using namespace dev;
 using namespace langutil;
 using namespace dev::solidity;
 
+namespace
+{
+
+/// Adds the names of the variables (expressions without arguments) in @a _expression
+/// to @a _variables. @a _visited holds the nodes that were already visited.
+void collectVariables(
+	smt::Expression const& _expression,
+	set<string>& _variables,
+	unordered_set<smt::ExpressionNode const*>& _visited
+)
+{
+	if (!_visited.insert(_expression.node()).second)
+		return;
+	if (_expression.arguments().empty())
+		_variables.insert(_expression.name());
+	for (auto const& argument: _expression.arguments())
+		collectVariables(argument, _variables, _visited);
+}
+
+}
+
 BMC::BMC(
 	smt::EncodingContext& _context,
 	ErrorReporter& _errorReporter,
 	map<h256, string> const& _smtlib2Responses,
 	ReadCallback::Callback const& _smtCallback,
-	smt::SMTSolverChoice _enabledSolvers
+	smt::SMTSolverChoice _enabledSolvers,
+	ModelCheckerSettings const& _settings
 ):
 	SMTEncoder(_context),
 	m_outerErrorReporter(_errorReporter),
-	m_interface(make_shared<smt::SMTPortfolio>(_smtlib2Responses, _smtCallback, _enabledSolvers))
+	m_interface(make_shared<smt::SMTPortfolio>(
+		_smtlib2Responses,
+		_smtCallback,
+		_enabledSolvers,
+		_settings
+	)),
+	m_smtlib2Responses(_smtlib2Responses),
+	m_enabledSolvers(_enabledSolvers),
+	m_settings(_settings)
 {
 #if defined (HAVE_Z3) || defined (HAVE_CVC4)
 	if (_enabledSolvers.some())
@@ -55,6 +89,7 @@ void BMC::analyze(SourceUnit const& _source, set<Expression const*> _safeAsserti
 	solAssert(_source.annotation().experimentalFeatures.count(ExperimentalFeature::SMTChecker), "");
 
 	m_safeAssertions += move(_safeAssertions);
+	m_summaries.clear();
 	m_context.setSolver(m_interface);
 	m_context.clear();
 	m_context.setAssertionAccumulation(true);
@@ -83,6 +118,14 @@ void BMC::analyze(SourceUnit const& _source, set<Expression const*> _safeAsserti
 	m_errorReporter.clear();
 }
 
+vector<string> BMC::unhandledQueries()
+{
+	vector<string> queries = m_interface->unhandledQueries();
+	for (Worker const& worker: m_workers)
+		queries += worker.solver->unhandledQueries();
+	return queries;
+}
+
 bool BMC::shouldInlineFunctionCall(FunctionCall const& _funCall)
 {
 	FunctionDefinition const* funDef = functionCallToDefinition(_funCall);
@@ -459,17 +502,208 @@ void BMC::inlineFunctionCall(FunctionCall const& _funCall)
 		solAssert((arguments.size() + firstParam) == functionParams.size(), "");
 		for (unsigned i = 0; i < arguments.size(); ++i)
 			funArgs.push_back(expr(*arguments.at(i), functionParams.at(i + firstParam)->type()));
-		initializeFunctionCallParameters(*funDef, funArgs);
 
-		// The reason why we need to pushCallStack here instead of visit(FunctionDefinition)
-		// is that there we don't have `_funCall`.
-		pushCallStack({funDef, &_funCall});
-		funDef->accept(*this);
+		// Calls from the initialization of state variables are visited without a caller.
+		if (m_settings.bmcSummaries && !m_callStack.empty())
+			summarizeFunctionCall(_funCall, *funDef, funArgs);
+		else
+		{
+			initializeFunctionCallParameters(*funDef, funArgs);
+
+			// The reason why we need to pushCallStack here instead of visit(FunctionDefinition)
+			// is that there we don't have `_funCall`.
+			pushCallStack({funDef, &_funCall});
+			funDef->accept(*this);
+		}
 	}
 
 	createReturnedExpressions(_funCall);
 }
 
+void BMC::summarizeFunctionCall(
+	FunctionCall const& _funCall,
+	FunctionDefinition const& _function,
+	vector<smt::Expression> const& _funArgs
+)
+{
+	FunctionSummary const& summary = functionSummary(_funCall, _function, _funArgs);
+
+	unordered_map<string, smt::Expression> substitutions;
+	solAssert(summary.parameters.size() == _funArgs.size(), "");
+	for (size_t i = 0; i < _funArgs.size(); ++i)
+		substitutions.emplace(summary.parameters[i].name(), _funArgs[i]);
+	for (auto const& variable: summary.stateVariables)
+		substitutions.emplace(variable.second.name(), currentValue(*variable.first));
+	substitutions.emplace(summary.balances.name(), m_context.balances().currentValue());
+
+	// The targets of the function see the variables of the caller as they are on entry.
+	auto callerModel = modelExpressions();
+	smt::Expression callerConstraints = currentPathConditions() && m_context.assertions();
+
+	for (auto const& variable: summary.outputs)
+		substitutions.emplace(variable.second.name(), m_context.newValue(*variable.first));
+	if (summary.balancesOutput)
+		substitutions.emplace(summary.balancesOutput->name(), m_context.balances().increaseIndex());
+	string suffix = "_call" + to_string(m_summaryInstances++);
+	for (auto const& local: summary.locals)
+		substitutions.emplace(local.first, m_context.newVariable(local.first + suffix, local.second));
+
+	m_context.addAssertion(smt::Expression::implies(
+		currentPathConditions(),
+		summary.constraints.substitute(substitutions)
+	));
+
+	for (VerificationTarget const& target: summary.targets)
+	{
+		vector<CallStackEntry> callStack = m_callStack;
+		callStack.emplace_back(&_function, &_funCall);
+		callStack += target.callStack;
+		auto model = callerModel;
+		for (size_t i = 0; i < target.modelExpressions.first.size(); ++i)
+		{
+			model.first.push_back(target.modelExpressions.first[i].substitute(substitutions));
+			model.second.push_back(target.modelExpressions.second[i]);
+		}
+		m_verificationTargets.emplace_back(VerificationTarget{
+			target.type,
+			target.value.substitute(substitutions),
+			callerConstraints && target.constraints.substitute(substitutions),
+			target.expression,
+			move(callStack),
+			move(model)
+		});
+	}
+
+	m_loopExecutionHappened = m_loopExecutionHappened || summary.loopExecutionHappened;
+	m_externalFunctionCallHappened = m_externalFunctionCallHappened || summary.externalFunctionCallHappened;
+	m_arrayAssignmentHappened = m_arrayAssignmentHappened || summary.arrayAssignmentHappened;
+}
+
+BMC::FunctionSummary const& BMC::functionSummary(
+	FunctionCall const& _funCall,
+	FunctionDefinition const& _function,
+	vector<smt::Expression> const& _funArgs
+)
+{
+	auto key = make_pair(m_currentContract, &_function);
+	if (m_summaries.count(key))
+		return m_summaries.at(key);
+
+	FunctionSummary summary;
+	string name = "summary_" + to_string(m_currentContract->id()) + "_" + to_string(_function.id());
+
+	// The body is encoded without the path conditions, assertions and targets of the caller
+	// and from new values of all variables it can read.
+	vector<VariableDeclaration const*> callerVariables;
+	for (auto const& variable: m_context.variables())
+		callerVariables.push_back(variable.first);
+	sort(callerVariables.begin(), callerVariables.end(), [](auto _a, auto _b) { return _a->id() < _b->id(); });
+	set<VariableDeclaration const*> callerVariableSet(callerVariables.begin(), callerVariables.end());
+
+	auto indicesBefore = copyVariableIndices();
+	unsigned balancesIndexBefore = m_context.balances().index();
+	auto pathConditions = move(m_pathConditions);
+	m_pathConditions.clear();
+	auto verificationTargets = move(m_verificationTargets);
+	m_verificationTargets.clear();
+	auto uninterpretedTerms = move(m_uninterpretedTerms);
+	m_uninterpretedTerms.clear();
+	bool loopExecutionHappened = exchange(m_loopExecutionHappened, false);
+	bool externalFunctionCallHappened = exchange(m_externalFunctionCallHappened, false);
+	bool arrayAssignmentHappened = exchange(m_arrayAssignmentHappened, false);
+	auto summaryCallerVariables = exchange(m_summaryCallerVariables, &callerVariableSet);
+	size_t declarationsBefore = m_interface->declarations().size();
+	size_t callStackBefore = m_callStack.size();
+
+	m_context.setAssertionAccumulation(false);
+	m_context.pushSolver();
+	m_context.setAssertionAccumulation(true);
+
+	for (size_t i = 0; i < _funArgs.size(); ++i)
+		summary.parameters.push_back(m_context.newVariable(name + "_arg" + to_string(i), _funArgs[i].sort()));
+	for (auto variable: callerVariables)
+		if (variable->isStateVariable())
+			summary.stateVariables.emplace_back(variable, m_context.newValue(*variable));
+	summary.balances = m_context.balances().increaseIndex();
+	auto indicesOnEntry = copyVariableIndices();
+	unsigned balancesIndexOnEntry = m_context.balances().index();
+
+	initializeFunctionCallParameters(_function, summary.parameters);
+	pushCallStack({&_function, &_funCall});
+	_function.accept(*this);
+	solAssert(m_callStack.size() == callStackBefore, "");
+
+	for (auto variable: callerVariables)
+		if (int(m_context.variable(*variable)->index()) != indicesOnEntry.at(variable))
+			summary.outputs.emplace_back(variable, currentValue(*variable));
+	// Return parameters that the caller already knows are outputs by the loop above.
+	for (auto const& param: _function.returnParameters())
+		if (!callerVariableSet.count(param.get()) && m_context.knownVariable(*param))
+			summary.outputs.emplace_back(param.get(), currentValue(*param));
+	if (m_context.balances().index() != balancesIndexOnEntry)
+		summary.balancesOutput = m_context.balances().currentValue();
+
+	summary.constraints = m_context.assertions();
+	m_context.popSolver();
+
+	summary.targets = move(m_verificationTargets);
+	for (auto& target: summary.targets)
+	{
+		solAssert(target.callStack.size() > callStackBefore, "");
+		target.callStack.erase(target.callStack.begin(), target.callStack.begin() + callStackBefore + 1);
+	}
+
+	// All other variables that were declared while encoding the body and occur in the
+	// summary are local to an execution of the function, except for the global symbols.
+	set<string> variables;
+	unordered_set<smt::ExpressionNode const*> visited;
+	collectVariables(summary.constraints, variables, visited);
+	for (auto const& target: summary.targets)
+	{
+		collectVariables(target.value, variables, visited);
+		collectVariables(target.constraints, variables, visited);
+		for (auto const& expression: target.modelExpressions.first)
+			collectVariables(expression, variables, visited);
+	}
+	set<string> nonLocals;
+	for (auto const& parameter: summary.parameters)
+		nonLocals.insert(parameter.name());
+	for (auto const& variable: summary.stateVariables)
+		nonLocals.insert(variable.second.name());
+	nonLocals.insert(summary.balances.name());
+	for (auto const& variable: summary.outputs)
+		nonLocals.insert(variable.second.name());
+	if (summary.balancesOutput)
+		nonLocals.insert(summary.balancesOutput->name());
+	for (auto const& symbol: m_context.globalSymbols())
+		nonLocals.insert(symbol.second->currentName());
+	nonLocals.insert(m_context.thisAddress().name());
+	auto const& declarations = m_interface->declarations();
+	for (size_t i = declarationsBefore; i < declarations.size(); ++i)
+		if (
+			declarations[i].second->kind != smt::Kind::Function &&
+			variables.count(declarations[i].first) &&
+			nonLocals.insert(declarations[i].first).second
+		)
+			summary.locals.push_back(declarations[i]);
+
+	summary.loopExecutionHappened = m_loopExecutionHappened;
+	summary.externalFunctionCallHappened = m_externalFunctionCallHappened;
+	summary.arrayAssignmentHappened = m_arrayAssignmentHappened;
+
+	resetVariableIndices(indicesBefore);
+	m_context.balances().index() = balancesIndexBefore;
+	m_pathConditions = move(pathConditions);
+	m_verificationTargets = move(verificationTargets);
+	m_uninterpretedTerms = move(uninterpretedTerms);
+	m_loopExecutionHappened = loopExecutionHappened;
+	m_externalFunctionCallHappened = externalFunctionCallHappened;
+	m_arrayAssignmentHappened = arrayAssignmentHappened;
+	m_summaryCallerVariables = summaryCallerVariables;
+
+	return m_summaries.emplace(key, move(summary)).first->second;
+}
+
 void BMC::abstractFunctionCall(FunctionCall const& _funCall)
 {
 	vector<smt::Expression> smtArguments;
@@ -539,7 +773,12 @@ pair<vector<smt::Expression>, vector<string>> BMC::modelExpressions()
 	vector<smt::Expression> expressionsToEvaluate;
 	vector<string> expressionNames;
 	for (auto const& var: m_context.variables())
-		if (var.first->type()->isValueType())
+		if (
+			var.first->type()->isValueType() &&
+			// While a summary is created, the values of the variables of the caller
+			// are only known at the call sites.
+			(!m_summaryCallerVariables || var.first->isStateVariable() || !m_summaryCallerVariables->count(var.first))
+		)
 		{
 			expressionsToEvaluate.emplace_back(currentValue(*var.first));
 			expressionNames.push_back(var.first->name());
@@ -570,35 +809,62 @@ pair<vector<smt::Expression>, vector<string>> BMC::modelExpressions()
 
 void BMC::checkVerificationTargets(smt::Expression const& _constraints)
 {
-	for (auto& target: m_verificationTargets)
-		checkVerificationTarget(target, _constraints);
+	size_t threads = m_settings.bmcThreads ? m_settings.bmcThreads : max(1u, thread::hardware_concurrency());
+	threads = min(threads, m_verificationTargets.size());
+	// Without an integrated solver, the queries have to go through the callback,
+	// which is only invoked from this thread.
+	if (threads <= 1 || m_interface->solvers() == 1)
+	{
+		for (auto& target: m_verificationTargets)
+			checkVerificationTarget(target, _constraints, *m_interface, m_errorReporter);
+		return;
+	}
+
+	prepareWorkers(threads);
+	// The targets are distributed to the threads in a fixed way, because the models a solver
+	// finds can depend on the queries it answered before.
+	vector<ErrorList> errors(m_verificationTargets.size());
+	parallelFor(threads, [&](size_t _thread) {
+		for (size_t i = _thread; i < m_verificationTargets.size(); i += threads)
+		{
+			ErrorReporter errorReporter(errors[i]);
+			checkVerificationTarget(m_verificationTargets[i], _constraints, *m_workers[_thread].solver, errorReporter);
+		}
+	});
+	for (ErrorList const& targetErrors: errors)
+		m_errorReporter.append(targetErrors);
 }
 
-void BMC::checkVerificationTarget(VerificationTarget& _target, smt::Expression const& _constraints)
+void BMC::checkVerificationTarget(
+	VerificationTarget& _target,
+	smt::Expression const& _constraints,
+	smt::SolverInterface& _solver,
+	ErrorReporter& _errorReporter
+)
 {
 	switch (_target.type)
 	{
 		case VerificationTarget::Type::ConstantCondition:
-			checkConstantCondition(_target);
+			solAssert(false, "Constant conditions are checked when their target is added.");
 			break;
 		case VerificationTarget::Type::Underflow:
-			checkUnderflow(_target, _constraints);
+			checkUnderflow(_target, _constraints, _solver, _errorReporter);
 			break;
 		case VerificationTarget::Type::Overflow:
-			checkOverflow(_target, _constraints);
+			checkOverflow(_target, _constraints, _solver, _errorReporter);
 			break;
 		case VerificationTarget::Type::UnderOverflow:
-			checkUnderflow(_target, _constraints);
-			checkOverflow(_target, _constraints);
+			checkUnderflow(_target, _constraints, _solver, _errorReporter);
+			checkOverflow(_target, _constraints, _solver, _errorReporter);
 			break;
 		case VerificationTarget::Type::DivByZero:
-			checkDivByZero(_target);
+			checkDivByZero(_target, _solver, _errorReporter);
 			break;
 		case VerificationTarget::Type::Balance:
-			checkBalance(_target);
+			checkBalance(_target, _solver, _errorReporter);
 			break;
 		case VerificationTarget::Type::Assert:
-			checkAssert(_target);
+			checkAssert(_target, _solver, _errorReporter);
 			break;
 		default:
 			solAssert(false, "");
@@ -616,7 +882,12 @@ void BMC::checkConstantCondition(VerificationTarget& _target)
 	);
 }
 
-void BMC::checkUnderflow(VerificationTarget& _target, smt::Expression const& _constraints)
+void BMC::checkUnderflow(
+	VerificationTarget& _target,
+	smt::Expression const& _constraints,
+	smt::SolverInterface& _solver,
+	ErrorReporter& _errorReporter
+)
 {
 	solAssert(
 		_target.type == VerificationTarget::Type::Underflow ||
@@ -626,6 +897,8 @@ void BMC::checkUnderflow(VerificationTarget& _target, smt::Expression const& _co
 	auto intType = dynamic_cast<IntegerType const*>(_target.expression->annotation().type);
 	solAssert(intType, "");
 	checkCondition(
+		_solver,
+		_errorReporter,
 		_target.constraints && _constraints && _target.value < smt::minValue(*intType),
 		_target.callStack,
 		_target.modelExpressions,
@@ -636,7 +909,12 @@ void BMC::checkUnderflow(VerificationTarget& _target, smt::Expression const& _co
 	);
 }
 
-void BMC::checkOverflow(VerificationTarget& _target, smt::Expression const& _constraints)
+void BMC::checkOverflow(
+	VerificationTarget& _target,
+	smt::Expression const& _constraints,
+	smt::SolverInterface& _solver,
+	ErrorReporter& _errorReporter
+)
 {
 	solAssert(
 		_target.type == VerificationTarget::Type::Overflow ||
@@ -646,6 +924,8 @@ void BMC::checkOverflow(VerificationTarget& _target, smt::Expression const& _con
 	auto intType = dynamic_cast<IntegerType const*>(_target.expression->annotation().type);
 	solAssert(intType, "");
 	checkCondition(
+		_solver,
+		_errorReporter,
 		_target.constraints && _constraints && _target.value > smt::maxValue(*intType),
 		_target.callStack,
 		_target.modelExpressions,
@@ -656,10 +936,12 @@ void BMC::checkOverflow(VerificationTarget& _target, smt::Expression const& _con
 	);
 }
 
-void BMC::checkDivByZero(VerificationTarget& _target)
+void BMC::checkDivByZero(VerificationTarget& _target, smt::SolverInterface& _solver, ErrorReporter& _errorReporter)
 {
 	solAssert(_target.type == VerificationTarget::Type::DivByZero, "");
 	checkCondition(
+		_solver,
+		_errorReporter,
 		_target.constraints && (_target.value == 0),
 		_target.callStack,
 		_target.modelExpressions,
@@ -670,10 +952,12 @@ void BMC::checkDivByZero(VerificationTarget& _target)
 	);
 }
 
-void BMC::checkBalance(VerificationTarget& _target)
+void BMC::checkBalance(VerificationTarget& _target, smt::SolverInterface& _solver, ErrorReporter& _errorReporter)
 {
 	solAssert(_target.type == VerificationTarget::Type::Balance, "");
 	checkCondition(
+		_solver,
+		_errorReporter,
 		_target.constraints && _target.value,
 		_target.callStack,
 		_target.modelExpressions,
@@ -683,11 +967,13 @@ void BMC::checkBalance(VerificationTarget& _target)
 	);
 }
 
-void BMC::checkAssert(VerificationTarget& _target)
+void BMC::checkAssert(VerificationTarget& _target, smt::SolverInterface& _solver, ErrorReporter& _errorReporter)
 {
 	solAssert(_target.type == VerificationTarget::Type::Assert, "");
 	if (!m_safeAssertions.count(_target.expression))
 		checkCondition(
+			_solver,
+			_errorReporter,
 			_target.constraints && !_target.value,
 			_target.callStack,
 			_target.modelExpressions,
@@ -711,14 +997,36 @@ void BMC::addVerificationTarget(
 		modelExpressions()
 	};
 	if (_type == VerificationTarget::Type::ConstantCondition)
-		checkVerificationTarget(target);
+		checkConstantCondition(target);
 	else
 		m_verificationTargets.emplace_back(move(target));
 }
 
 /// Solving.
 
+void BMC::prepareWorkers(size_t _count)
+{
+	while (m_workers.size() < _count)
+		m_workers.emplace_back(Worker{
+			make_unique<smt::SMTPortfolio>(
+				m_smtlib2Responses,
+				ReadCallback::Callback{},
+				m_enabledSolvers,
+				m_settings
+			)
+		});
+	auto const& declarations = m_interface->declarations();
+	for (Worker& worker: m_workers)
+	{
+		for (size_t i = worker.declarations; i < declarations.size(); ++i)
+			worker.solver->declareVariable(declarations[i].first, declarations[i].second);
+		worker.declarations = declarations.size();
+	}
+}
+
 void BMC::checkCondition(
+	smt::SolverInterface& _solver,
+	ErrorReporter& _errorReporter,
 	smt::Expression _condition,
 	vector<SMTEncoder::CallStackEntry> const& callStack,
 	pair<vector<smt::Expression>, vector<string>> const& _modelExpressions,
@@ -728,8 +1036,8 @@ void BMC::checkCondition(
 	smt::Expression const* _additionalValue
 )
 {
-	m_interface->push();
-	m_interface->addAssertion(_condition);
+	_solver.push();
+	_solver.addAssertion(_condition);
 
 	vector<smt::Expression> expressionsToEvaluate;
 	vector<string> expressionNames;
@@ -742,7 +1050,7 @@ void BMC::checkCondition(
 		}
 	smt::CheckResult result;
 	vector<string> values;
-	tie(result, values) = checkSatisfiableAndGenerateModel(expressionsToEvaluate);
+	tie(result, values) = checkSatisfiableAndGenerateModel(_solver, _errorReporter, expressionsToEvaluate);
 
 	string extraComment = SMTEncoder::extraComment();
 	if (m_loopExecutionHappened)
@@ -772,12 +1080,12 @@ void BMC::checkCondition(
 			solAssert(values.size() == expressionNames.size(), "");
 			map<string, string> sortedModel;
 			for (size_t i = 0; i < values.size(); ++i)
-				if (expressionsToEvaluate.at(i).name != values.at(i))
+				if (expressionsToEvaluate.at(i).name() != values.at(i))
 					sortedModel[expressionNames.at(i)] = values.at(i);
 
 			for (auto const& eval: sortedModel)
 				modelMessage << "  " << eval.first << " = " << eval.second << "\n";
-			m_errorReporter.warning(
+			_errorReporter.warning(
 				_location,
 				message.str(),
 				SecondarySourceLocation().append(modelMessage.str(), SourceLocation{})
@@ -788,24 +1096,24 @@ void BMC::checkCondition(
 		else
 		{
 			message << ".";
-			m_errorReporter.warning(_location, message.str(), secondaryLocation);
+			_errorReporter.warning(_location, message.str(), secondaryLocation);
 		}
 		break;
 	}
 	case smt::CheckResult::UNSATISFIABLE:
 		break;
 	case smt::CheckResult::UNKNOWN:
-		m_errorReporter.warning(_location, _description + " might happen here.", secondaryLocation);
+		_errorReporter.warning(_location, _description + " might happen here.", secondaryLocation);
 		break;
 	case smt::CheckResult::CONFLICTING:
-		m_errorReporter.warning(_location, "At least two SMT solvers provided conflicting answers. Results might not be sound.");
+		_errorReporter.warning(_location, "At least two SMT solvers provided conflicting answers. Results might not be sound.");
 		break;
 	case smt::CheckResult::ERROR:
-		m_errorReporter.warning(_location, "Error trying to invoke SMT solver.");
+		_errorReporter.warning(_location, "Error trying to invoke SMT solver.");
 		break;
 	}
 
-	m_interface->pop();
+	_solver.pop();
 }
 
 void BMC::checkBooleanNotConstant(
@@ -866,21 +1174,24 @@ void BMC::checkBooleanNotConstant(
 	}
 }
 
-pair<smt::CheckResult, vector<string>>
-BMC::checkSatisfiableAndGenerateModel(vector<smt::Expression> const& _expressionsToEvaluate)
+pair<smt::CheckResult, vector<string>> BMC::checkSatisfiableAndGenerateModel(
+	smt::SolverInterface& _solver,
+	ErrorReporter& _errorReporter,
+	vector<smt::Expression> const& _expressionsToEvaluate
+)
 {
 	smt::CheckResult result;
 	vector<string> values;
 	try
 	{
-		tie(result, values) = m_interface->check(_expressionsToEvaluate);
+		tie(result, values) = _solver.check(_expressionsToEvaluate);
 	}
 	catch (smt::SolverError const& _e)
 	{
 		string description("Error querying SMT solver");
 		if (_e.comment())
 			description += ": " + *_e.comment();
-		m_errorReporter.warning(description);
+		_errorReporter.warning(description);
 		result = smt::CheckResult::ERROR;
 	}
 
@@ -899,6 +1210,6 @@ BMC::checkSatisfiableAndGenerateModel(vector<smt::Expression> const& _expression
 
 smt::CheckResult BMC::checkSatisfiable()
 {
-	return checkSatisfiableAndGenerateModel({}).first;
+	return checkSatisfiableAndGenerateModel(*m_interface, m_errorReporter, {}).first;
 }
 
@@ -18,7 +18,8 @@
  * Class that implements an SMT-based Bounded Model Checker (BMC).
  * Traverses the AST such that:
  * - Loops are unrolled
- * - Internal function calls are inlined
+ * - Internal function calls are inlined, or summarized if
+ *   ModelCheckerSettings::bmcSummaries is set
  * Creates verification targets for:
  * - Underflow/Overflow
  * - Constant conditions
@@ -29,12 +30,16 @@
 
 
 #include <libsolidity/formal/EncodingContext.h>
+#include <libsolidity/formal/ModelCheckerSettings.h>
 #include <libsolidity/formal/SMTEncoder.h>
+#include <libsolidity/formal/SMTPortfolio.h>
 #include <libsolidity/formal/SolverInterface.h>
 
 #include <libsolidity/interface/ReadFile.h>
 #include <liblangutil/ErrorReporter.h>
 
+#include <map>
+#include <optional>
 #include <set>
 #include <string>
 #include <vector>
@@ -58,7 +63,8 @@ public:
 		langutil::ErrorReporter& _errorReporter,
 		std::map<h256, std::string> const& _smtlib2Responses,
 		ReadCallback::Callback const& _smtCallback,
-		smt::SMTSolverChoice _enabledSolvers
+		smt::SMTSolverChoice _enabledSolvers,
+		ModelCheckerSettings const& _settings
 	);
 
 	void analyze(SourceUnit const& _sources, std::set<Expression const*> _safeAssertions);
@@ -66,7 +72,7 @@ public:
 	/// This is used if the SMT solver is not directly linked into this binary.
 	/// @returns a list of inputs to the SMT solver that were not part of the argument to
 	/// the constructor.
-	std::vector<std::string> unhandledQueries() { return m_interface->unhandledQueries(); }
+	std::vector<std::string> unhandledQueries();
 
 	/// @returns true if _funCall should be inlined, otherwise false.
 	static bool shouldInlineFunctionCall(FunctionCall const& _funCall);
@@ -96,6 +102,13 @@ private:
 	/// Visits the FunctionDefinition of the called function
 	/// if available and inlines the return value.
 	void inlineFunctionCall(FunctionCall const& _funCall);
+	/// Encodes a call of _function with the arguments _funArgs by instantiating the summary of
+	/// _function instead of visiting its body.
+	void summarizeFunctionCall(
+		FunctionCall const& _funCall,
+		FunctionDefinition const& _function,
+		std::vector<smt::Expression> const& _funArgs
+	);
 	/// Creates an uninterpreted function call.
 	void abstractFunctionCall(FunctionCall const& _funCall);
 	/// Inlines if the function call is internal or external to `this`.
@@ -129,14 +142,32 @@ private:
 		std::pair<std::vector<smt::Expression>, std::vector<std::string>> modelExpressions;
 	};
 
+	/// Checks all targets of m_verificationTargets, concurrently if more than one
+	/// BMC thread is configured and an integrated solver is available.
 	void checkVerificationTargets(smt::Expression const& _constraints);
-	void checkVerificationTarget(VerificationTarget& _target, smt::Expression const& _constraints = smt::Expression(true));
+	/// Checks @a _target using @a _solver and reports the results to @a _errorReporter.
+	void checkVerificationTarget(
+		VerificationTarget& _target,
+		smt::Expression const& _constraints,
+		smt::SolverInterface& _solver,
+		langutil::ErrorReporter& _errorReporter
+	);
 	void checkConstantCondition(VerificationTarget& _target);
-	void checkUnderflow(VerificationTarget& _target, smt::Expression const& _constraints);
-	void checkOverflow(VerificationTarget& _target, smt::Expression const& _constraints);
-	void checkDivByZero(VerificationTarget& _target);
-	void checkBalance(VerificationTarget& _target);
-	void checkAssert(VerificationTarget& _target);
+	void checkUnderflow(
+		VerificationTarget& _target,
+		smt::Expression const& _constraints,
+		smt::SolverInterface& _solver,
+		langutil::ErrorReporter& _errorReporter
+	);
+	void checkOverflow(
+		VerificationTarget& _target,
+		smt::Expression const& _constraints,
+		smt::SolverInterface& _solver,
+		langutil::ErrorReporter& _errorReporter
+	);
+	void checkDivByZero(VerificationTarget& _target, smt::SolverInterface& _solver, langutil::ErrorReporter& _errorReporter);
+	void checkBalance(VerificationTarget& _target, smt::SolverInterface& _solver, langutil::ErrorReporter& _errorReporter);
+	void checkAssert(VerificationTarget& _target, smt::SolverInterface& _solver, langutil::ErrorReporter& _errorReporter);
 	void addVerificationTarget(
 		VerificationTarget::Type _type,
 		smt::Expression const& _value,
@@ -146,8 +177,16 @@ private:
 
 	/// Solver related.
 	//@{
+	/// Creates or extends the solvers of the BMC threads such that there are at least
+	/// @a _count of them and all variables of m_interface are declared in them.
+	void prepareWorkers(size_t _count);
+
 	/// Check that a condition can be satisfied.
+	/// This only reads the state of the BMC, so that different solvers
+	/// can check conditions concurrently.
 	void checkCondition(
+		smt::SolverInterface& _solver,
+		langutil::ErrorReporter& _errorReporter,
 		smt::Expression _condition,
 		std::vector<CallStackEntry> const& callStack,
 		std::pair<std::vector<smt::Expression>, std::vector<std::string>> const& _modelExpressions,
@@ -166,12 +205,57 @@ private:
 		std::vector<CallStackEntry> const& _callStack,
 		std::string const& _description
 	);
-	std::pair<smt::CheckResult, std::vector<std::string>>
-	checkSatisfiableAndGenerateModel(std::vector<smt::Expression> const& _expressionsToEvaluate);
+	std::pair<smt::CheckResult, std::vector<std::string>> checkSatisfiableAndGenerateModel(
+		smt::SolverInterface& _solver,
+		langutil::ErrorReporter& _errorReporter,
+		std::vector<smt::Expression> const& _expressionsToEvaluate
+	);
 
 	smt::CheckResult checkSatisfiable();
 	//@}
 
+	/// Function summaries.
+	//@{
+	/// Encoding of the body of a function that is reused at all its call sites.
+	/// The body is encoded once, from placeholders for the arguments and for the state on entry,
+	/// and the resulting constraints and verification targets are instantiated at each
+	/// call site by replacing the placeholders by the actual values, the values on exit by
+	/// new values of the changed variables and all other variables by fresh ones.
+	struct FunctionSummary
+	{
+		/// Placeholders for the arguments.
+		std::vector<smt::Expression> parameters;
+		/// Placeholders for the values of the state variables and the balances on entry.
+		std::vector<std::pair<VariableDeclaration const*, smt::Expression>> stateVariables;
+		smt::Expression balances{true};
+		/// Values on exit of the variables that the function changes, including the return parameters.
+		std::vector<std::pair<VariableDeclaration const*, smt::Expression>> outputs;
+		std::optional<smt::Expression> balancesOutput;
+		/// Variables that are local to one execution of the function.
+		std::vector<std::pair<std::string, smt::SortPointer>> locals;
+		smt::Expression constraints{true};
+		/// Verification targets of the body, with the call stack relative to the function.
+		std::vector<VerificationTarget> targets;
+		bool loopExecutionHappened = false;
+		bool externalFunctionCallHappened = false;
+		bool arrayAssignmentHappened = false;
+	};
+	/// @returns the summary of _function in the current contract, which is created
+	/// from the call _funCall with the arguments _funArgs if it does not exist yet.
+	FunctionSummary const& functionSummary(
+		FunctionCall const& _funCall,
+		FunctionDefinition const& _function,
+		std::vector<smt::Expression> const& _funArgs
+	);
+
+	std::map<std::pair<ContractDefinition const*, FunctionDefinition const*>, FunctionSummary> m_summaries;
+	/// Variables that existed when the summary that is being created was started,
+	/// nullptr if no summary is being created.
+	std::set<VariableDeclaration const*> const* m_summaryCallerVariables = nullptr;
+	/// Number of instantiated summaries, used to name their local variables.
+	size_t m_summaryInstances = 0;
+	//@}
+
 	/// Flags used for better warning messages.
 	bool m_loopExecutionHappened = false;
 	bool m_externalFunctionCallHappened = false;
@@ -184,7 +268,20 @@ private:
 	/// Assertions that are known to be safe.
 	std::set<Expression const*> m_safeAssertions;
 
-	std::shared_ptr<smt::SolverInterface> m_interface;
+	std::shared_ptr<smt::SMTPortfolio> m_interface;
+
+	/// Solvers used to check verification targets concurrently.
+	struct Worker
+	{
+		std::unique_ptr<smt::SMTPortfolio> solver;
+		/// Number of declarations of m_interface that were replayed in the solver.
+		size_t declarations = 0;
+	};
+	std::vector<Worker> m_workers;
+	/// Responses to SMT-LIB2 queries, which the solvers only refer to.
+	std::map<h256, std::string> const& m_smtlib2Responses;
+	smt::SMTSolverChoice m_enabledSolvers;
+	ModelCheckerSettings m_settings;
 };
 
 }
@@ -37,13 +37,14 @@ CHC::CHC(
 	ErrorReporter& _errorReporter,
 	map<h256, string> const& _smtlib2Responses,
 	ReadCallback::Callback const& _smtCallback,
-	smt::SMTSolverChoice _enabledSolvers
+	smt::SMTSolverChoice _enabledSolvers,
+	ModelCheckerSettings const& _settings
 ):
 	SMTEncoder(_context),
 #ifdef HAVE_Z3
 	m_interface(
 		_enabledSolvers.z3 ?
-		dynamic_pointer_cast<smt::CHCSolverInterface>(make_shared<smt::Z3CHCInterface>()) :
+		dynamic_pointer_cast<smt::CHCSolverInterface>(make_shared<smt::Z3CHCInterface>(_settings)) :
 		dynamic_pointer_cast<smt::CHCSolverInterface>(make_shared<smt::CHCSmtLib2Interface>(_smtlib2Responses, _smtCallback))
 	),
 #else
@@ -55,6 +56,7 @@ CHC::CHC(
 	(void)_smtlib2Responses;
 	(void)_enabledSolvers;
 	(void)_smtCallback;
+	(void)_settings;
 }
 
 void CHC::analyze(SourceUnit const& _source)
@@ -88,7 +90,7 @@ void CHC::analyze(SourceUnit const& _source)
 	);
 	m_genesisPredicate = createSymbolicBlock(genesisSort, "genesis");
 	auto genesis = (*m_genesisPredicate)({});
-	addRule(genesis, genesis.name);
+	addRule(genesis, genesis.name());
 
 	_source.accept(*this);
 }
@@ -655,7 +657,7 @@ void CHC::connectBlocks(smt::Expression const& _from, smt::Expression const& _to
 		_from && m_context.assertions() && _constraints,
 		_to
 	);
-	addRule(edge, _from.name + "_to_" + _to.name);
+	addRule(edge, _from.name() + "_to_" + _to.name());
 }
 
 vector<smt::Expression> CHC::currentStateVariables()
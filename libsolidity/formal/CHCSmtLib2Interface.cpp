@@ -53,17 +53,17 @@ void CHCSmtLib2Interface::reset()
 
 void CHCSmtLib2Interface::registerRelation(smt::Expression const& _expr)
 {
-	solAssert(_expr.sort, "");
-	solAssert(_expr.sort->kind == smt::Kind::Function, "");
-	if (!m_variables.count(_expr.name))
+	solAssert(_expr.sort(), "");
+	solAssert(_expr.sort()->kind == smt::Kind::Function, "");
+	if (!m_variables.count(_expr.name()))
 	{
-		auto fSort = dynamic_pointer_cast<FunctionSort>(_expr.sort);
+		auto fSort = dynamic_pointer_cast<FunctionSort>(_expr.sort());
 		string domain = m_smtlib2->toSmtLibSort(fSort->domain);
 		// Relations are predicates which have implicit codomain Bool.
-		m_variables.insert(_expr.name);
+		m_variables.insert(_expr.name());
 		write(
 			"(declare-rel |" +
-			_expr.name +
+			_expr.name() +
 			"| " +
 			domain +
 			")"
@@ -92,7 +92,7 @@ pair<CheckResult, vector<string>> CHCSmtLib2Interface::query(smt::Expression con
 
 	string response = querySolver(
 		m_accumulatedOutput +
-		"\n(query " + _block.name + " :print-certificate true)"
+		"\n(query " + _block.name() + " :print-certificate true)"
 	);
 
 	CheckResult result;
@@ -131,6 +131,8 @@ public:
 	Expression thisAddress();
 	/// @returns the symbolic balance of address `this`.
 	Expression balance();
+	/// @returns the symbolic balances of all addresses.
+	SymbolicVariable& balances() { return *m_balances; }
 	/// @returns the symbolic balance of an address.
 	Expression balance(Expression _address);
 	/// Transfer _value from _from to _to.
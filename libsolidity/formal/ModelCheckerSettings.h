@@ -0,0 +1,88 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Settings of the model checker.
+ */
+
+#pragma once
+
+#include <optional>
+#include <string>
+
+namespace dev
+{
+namespace solidity
+{
+
+/// How SMTPortfolio combines the answers of the solvers it uses.
+enum class SMTPortfolioMode
+{
+	Sequential, // query the solvers one after the other and report if their answers differ
+	Race, // query the solvers concurrently and use the first answer
+	CrossCheck // query the solvers concurrently and wait for a second answer to confirm the first
+};
+
+inline std::string portfolioModeToString(SMTPortfolioMode _mode)
+{
+	switch (_mode)
+	{
+	case SMTPortfolioMode::Sequential: return "sequential";
+	case SMTPortfolioMode::Race: return "race";
+	case SMTPortfolioMode::CrossCheck: return "crossCheck";
+	}
+	// Cannot reach this.
+	return "INVALID";
+}
+
+inline std::optional<SMTPortfolioMode> portfolioModeFromString(std::string const& _mode)
+{
+	for (auto i: {SMTPortfolioMode::Sequential, SMTPortfolioMode::Race, SMTPortfolioMode::CrossCheck})
+		if (portfolioModeToString(i) == _mode)
+			return i;
+	return {};
+}
+
+struct ModelCheckerSettings
+{
+	SMTPortfolioMode portfolioMode = SMTPortfolioMode::Sequential;
+	/// Number of threads that check the verification targets of a function in BMC,
+	/// each with solvers of its own. Zero means one thread per hardware thread.
+	unsigned bmcThreads = 1;
+	/// Whether BMC encodes the body of each internally called function once per contract
+	/// and instantiates it at the call sites instead of inlining the function at each call.
+	bool bmcSummaries = false;
+	/// Whether SMT-LIB2 queries are sent to the callback as the commands that changed since the
+	/// previous query of the same session instead of as the whole query.
+	bool smtlib2Sessions = false;
+	/// Directory in which the answers of the SMT solvers are kept across compilations.
+	/// The answers are not kept if it is empty.
+	std::string cacheDirectory;
+
+	bool operator==(ModelCheckerSettings const& _other) const
+	{
+		return
+			portfolioMode == _other.portfolioMode &&
+			bmcThreads == _other.bmcThreads &&
+			bmcSummaries == _other.bmcSummaries &&
+			smtlib2Sessions == _other.smtlib2Sessions &&
+			cacheDirectory == _other.cacheDirectory;
+	}
+	bool operator!=(ModelCheckerSettings const& _other) const { return !(*this == _other); }
+};
+
+}
+}
@@ -24,6 +24,7 @@
 #include <boost/filesystem/operations.hpp>
 
 #include <array>
+#include <atomic>
 #include <fstream>
 #include <iostream>
 #include <memory>
@@ -36,19 +37,36 @@ using namespace dev::solidity::smt;
 
 SMTLib2Interface::SMTLib2Interface(
 	map<h256, string> const& _queryResponses,
-	ReadCallback::Callback const& _smtCallback
+	ReadCallback::Callback const& _smtCallback,
+	bool _useSession
 ):
 	m_queryResponses(_queryResponses),
+	m_useSession(_useSession && _smtCallback),
 	m_smtCallback(_smtCallback)
 {
+	static atomic<size_t> sessionCount{0};
+	if (m_useSession)
+		m_sessionID = sessionCount++;
 	reset();
 }
 
+SMTLib2Interface::~SMTLib2Interface()
+{
+	if (m_useSession && m_sessionStarted)
+		m_smtCallback(
+			ReadCallback::kindString(ReadCallback::Kind::SMTSession),
+			"; session " + to_string(m_sessionID) + "\n(exit)\n"
+		);
+}
+
 void SMTLib2Interface::reset()
 {
+	m_sessionCommands = m_sessionStarted ? "(reset)\n" : "";
 	m_accumulatedOutput.clear();
 	m_accumulatedOutput.emplace_back();
 	m_variables.clear();
+	m_sexprs.clear();
+	m_sexprsSize = 0;
 	write("(set-option :produce-models true)");
 	write("(set-logic ALL)");
 }
@@ -56,12 +74,16 @@ void SMTLib2Interface::reset()
 void SMTLib2Interface::push()
 {
 	m_accumulatedOutput.emplace_back();
+	if (m_useSession)
+		m_sessionCommands += "(push 1)\n";
 }
 
 void SMTLib2Interface::pop()
 {
 	solAssert(!m_accumulatedOutput.empty(), "");
 	m_accumulatedOutput.pop_back();
+	if (m_useSession)
+		m_sessionCommands += "(pop 1)\n";
 }
 
 void SMTLib2Interface::declareVariable(string const& _name, SortPointer const& _sort)
@@ -106,10 +128,12 @@ void SMTLib2Interface::addAssertion(smt::Expression const& _expr)
 
 pair<CheckResult, vector<string>> SMTLib2Interface::check(vector<smt::Expression> const& _expressionsToEvaluate)
 {
-	string response = querySolver(
-		boost::algorithm::join(m_accumulatedOutput, "\n") +
-		checkSatAndGetValuesCommand(_expressionsToEvaluate)
-	);
+	string command = checkSatAndGetValuesCommand(_expressionsToEvaluate);
+	string response;
+	if (auto sessionResponse = querySession(command))
+		response = move(*sessionResponse);
+	else
+		response = querySolver(boost::algorithm::join(m_accumulatedOutput, "\n") + command);
 
 	CheckResult result;
 	// TODO proper parsing
@@ -130,28 +154,60 @@ pair<CheckResult, vector<string>> SMTLib2Interface::check(vector<smt::Expression
 
 string SMTLib2Interface::toSExpr(smt::Expression const& _expr)
 {
-	if (_expr.arguments.empty())
-		return _expr.name;
+	string sexpr;
+	appendSExpr(_expr, sexpr);
+	return sexpr;
+}
+
+void SMTLib2Interface::appendSExpr(smt::Expression const& _expr, string& _sexpr)
+{
+	if (_expr.arguments().empty())
+	{
+		_sexpr += _expr.name();
+		return;
+	}
+
+	auto it = m_sexprs.find(_expr);
+	if (it != m_sexprs.end())
+	{
+		_sexpr += it->second;
+		return;
+	}
 
-	std::string sexpr = "(";
-	if (_expr.name == "const_array")
+	size_t start = _sexpr.size();
+	_sexpr += "(";
+	if (_expr.name() == "const_array")
 	{
-		solAssert(_expr.arguments.size() == 2, "");
-		auto sortSort = std::dynamic_pointer_cast<SortSort>(_expr.arguments.at(0).sort);
+		solAssert(_expr.arguments().size() == 2, "");
+		auto sortSort = std::dynamic_pointer_cast<SortSort>(_expr.arguments().at(0).sort());
 		solAssert(sortSort, "");
 		auto arraySort = dynamic_pointer_cast<ArraySort>(sortSort->inner);
 		solAssert(arraySort, "");
-		sexpr += "(as const " + toSmtLibSort(*arraySort) + ") ";
-		sexpr += toSExpr(_expr.arguments.at(1));
+		_sexpr += "(as const " + toSmtLibSort(*arraySort) + ") ";
+		appendSExpr(_expr.arguments().at(1), _sexpr);
 	}
 	else
 	{
-		sexpr += _expr.name;
-		for (auto const& arg: _expr.arguments)
-			sexpr += " " + toSExpr(arg);
+		_sexpr += _expr.name();
+		for (auto const& arg: _expr.arguments())
+		{
+			_sexpr += " ";
+			appendSExpr(arg, _sexpr);
+		}
+	}
+	_sexpr += ")";
+
+	size_t length = _sexpr.size() - start;
+	if (m_sexprsSize + length > sexprCacheLimit)
+	{
+		m_sexprs.clear();
+		m_sexprsSize = 0;
+	}
+	if (length <= sexprCacheLimit)
+	{
+		m_sexprs.emplace(_expr, _sexpr.substr(start));
+		m_sexprsSize += length;
 	}
-	sexpr += ")";
-	return sexpr;
 }
 
 string SMTLib2Interface::toSmtLibSort(Sort const& _sort)
@@ -185,6 +241,8 @@ string SMTLib2Interface::toSmtLibSort(vector<SortPointer> const& _sorts)
 void SMTLib2Interface::write(string _data)
 {
 	solAssert(!m_accumulatedOutput.empty(), "");
+	if (m_useSession)
+		m_sessionCommands += _data + "\n";
 	m_accumulatedOutput.back() += move(_data) + "\n";
 }
 
@@ -199,8 +257,8 @@ string SMTLib2Interface::checkSatAndGetValuesCommand(vector<smt::Expression> con
 		for (size_t i = 0; i < _expressionsToEvaluate.size(); i++)
 		{
 			auto const& e = _expressionsToEvaluate.at(i);
-			solAssert(e.sort->kind == Kind::Int || e.sort->kind == Kind::Bool, "Invalid sort for expression to evaluate.");
-			command += "(declare-const |EVALEXPR_" + to_string(i) + "| " + (e.sort->kind == Kind::Int ? "Int" : "Bool") + ")\n";
+			solAssert(e.sort()->kind == Kind::Int || e.sort()->kind == Kind::Bool, "Invalid sort for expression to evaluate.");
+			command += "(declare-const |EVALEXPR_" + to_string(i) + "| " + (e.sort()->kind == Kind::Int ? "Int" : "Bool") + ")\n";
 			command += "(assert (= |EVALEXPR_" + to_string(i) + "| " + toSExpr(e) + "))\n";
 		}
 		command += "(check-sat)\n";
@@ -234,12 +292,41 @@ string SMTLib2Interface::querySolver(string const& _input)
 	h256 inputHash = dev::keccak256(_input);
 	if (m_queryResponses.count(inputHash))
 		return m_queryResponses.at(inputHash);
+	if (m_callbackResponses.count(inputHash))
+		return m_callbackResponses.at(inputHash);
 	if (m_smtCallback)
 	{
 		auto result = m_smtCallback(ReadCallback::kindString(ReadCallback::Kind::SMTQuery), _input);
 		if (result.success)
-			return result.responseOrErrorMessage;
+			return m_callbackResponses[inputHash] = move(result.responseOrErrorMessage);
 	}
 	m_unhandledQueries.push_back(_input);
 	return "unknown\n";
 }
+
+optional<string> SMTLib2Interface::querySession(string const& _check)
+{
+	if (!m_useSession)
+		return {};
+	// The values to evaluate are declared in a scope of their own, so that the session
+	// can declare them again for the next check.
+	auto result = m_smtCallback(
+		ReadCallback::kindString(ReadCallback::Kind::SMTSession),
+		"; session " + to_string(m_sessionID) + "\n" + m_sessionCommands + "(push 1)\n" + _check + "(pop 1)\n"
+	);
+	if (!result.success)
+	{
+		// The state of the session is unknown now, so all further checks send whole queries.
+		if (m_sessionStarted)
+			m_smtCallback(
+				ReadCallback::kindString(ReadCallback::Kind::SMTSession),
+				"; session " + to_string(m_sessionID) + "\n(exit)\n"
+			);
+		m_useSession = false;
+		m_sessionCommands.clear();
+		return {};
+	}
+	m_sessionStarted = true;
+	m_sessionCommands.clear();
+	return move(result.responseOrErrorMessage);
+}
@@ -27,6 +27,7 @@
 #include <boost/noncopyable.hpp>
 #include <cstdio>
 #include <map>
+#include <optional>
 #include <set>
 #include <string>
 #include <vector>
@@ -38,13 +39,28 @@ namespace solidity
 namespace smt
 {
 
+/**
+ * Solver interface that produces SMT-LIB2 queries and obtains their answers from the given
+ * responses or the callback.
+ *
+ * By default, every check sends the whole query, which consists of all declarations and
+ * assertions, with the kind "smt-query" to the callback.
+ * In session mode, the callback is expected to keep a solver process per session instead.
+ * Every check then only sends the commands since the previous check of the same session
+ * with the kind "smt-session". The data starts with the line "; session <id>" and the
+ * commands can contain "(reset)", "(push 1)" and "(pop 1)". The final "(exit)" of a session is
+ * sent when the interface is destroyed. If the callback does not answer a session query, the
+ * interface falls back to sending whole queries.
+ */
 class SMTLib2Interface: public SolverInterface, public boost::noncopyable
 {
 public:
 	explicit SMTLib2Interface(
 		std::map<h256, std::string> const& _queryResponses,
-		ReadCallback::Callback const& _smtCallback
+		ReadCallback::Callback const& _smtCallback,
+		bool _useSession = false
 	);
+	~SMTLib2Interface() override;
 
 	void reset() override;
 
@@ -70,18 +86,39 @@ private:
 
 	void write(std::string _data);
 
+	/// Appends the S-expression of @a _expr to @a _sexpr.
+	void appendSExpr(smt::Expression const& _expr, std::string& _sexpr);
+
 	std::string checkSatAndGetValuesCommand(std::vector<smt::Expression> const& _expressionsToEvaluate);
 	std::vector<std::string> parseValues(std::string::const_iterator _start, std::string::const_iterator _end);
 
 	/// Communicates with the solver via the callback. Throws SMTSolverError on error.
 	std::string querySolver(std::string const& _input);
+	/// Sends the commands since the previous query of the session and @a _check to the callback.
+	/// @returns the answer of the callback, unless the session failed.
+	std::optional<std::string> querySession(std::string const& _check);
 
 	std::vector<std::string> m_accumulatedOutput;
 	std::map<std::string, SortPointer> m_variables;
 
+	/// S-expressions of the compound expressions seen so far. The cache is cleared whenever
+	/// its strings would take more than sexprCacheLimit bytes.
+	ExpressionMap<std::string> m_sexprs;
+	size_t m_sexprsSize = 0;
+	static size_t constexpr sexprCacheLimit = 16 * 1024 * 1024;
+
 	std::map<h256, std::string> const& m_queryResponses;
+	/// Answers of the callback to the queries sent so far.
+	std::map<h256, std::string> m_callbackResponses;
 	std::vector<std::string> m_unhandledQueries;
 
+	bool m_useSession = false;
+	size_t m_sessionID = 0;
+	/// Whether the callback already received commands of this session.
+	bool m_sessionStarted = false;
+	/// Commands that the session did not receive yet.
+	std::string m_sessionCommands;
+
 	ReadCallback::Callback m_smtCallback;
 };
 
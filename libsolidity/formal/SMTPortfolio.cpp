@@ -25,6 +25,13 @@
 #endif
 #include <libsolidity/formal/SMTLib2Interface.h>
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
 using namespace std;
 using namespace dev;
 using namespace dev::solidity;
@@ -33,10 +40,12 @@ using namespace dev::solidity::smt;
 SMTPortfolio::SMTPortfolio(
 	map<h256, string> const& _smtlib2Responses,
 	ReadCallback::Callback const& _smtCallback,
-	SMTSolverChoice _enabledSolvers
-)
+	SMTSolverChoice _enabledSolvers,
+	ModelCheckerSettings const& _settings
+):
+	m_mode(_settings.portfolioMode)
 {
-	m_solvers.emplace_back(make_unique<smt::SMTLib2Interface>(_smtlib2Responses, _smtCallback));
+	m_solvers.emplace_back(make_unique<smt::SMTLib2Interface>(_smtlib2Responses, _smtCallback, _settings.smtlib2Sessions));
 #ifdef HAVE_Z3
 	if (_enabledSolvers.z3)
 		m_solvers.emplace_back(make_unique<smt::Z3Interface>());
@@ -46,24 +55,45 @@ SMTPortfolio::SMTPortfolio(
 		m_solvers.emplace_back(make_unique<smt::CVC4Interface>());
 #endif
 	(void)_enabledSolvers;
+
+	if (!_settings.cacheDirectory.empty())
+	{
+		string solvers = "smtlib2";
+#ifdef HAVE_Z3
+		if (_enabledSolvers.z3)
+			solvers += " z3-" + Z3Interface::version();
+#endif
+#ifdef HAVE_CVC4
+		if (_enabledSolvers.cvc4)
+			solvers += " cvc4-" + CVC4Interface::version();
+#endif
+		m_cache = make_unique<SMTResultCache>(_settings.cacheDirectory, solvers);
+	}
 }
 
 void SMTPortfolio::reset()
 {
 	for (auto const& s: m_solvers)
 		s->reset();
+	m_declarations.clear();
+	if (m_cache)
+		m_cache->reset();
 }
 
 void SMTPortfolio::push()
 {
 	for (auto const& s: m_solvers)
 		s->push();
+	if (m_cache)
+		m_cache->push();
 }
 
 void SMTPortfolio::pop()
 {
 	for (auto const& s: m_solvers)
 		s->pop();
+	if (m_cache)
+		m_cache->pop();
 }
 
 void SMTPortfolio::declareVariable(string const& _name, SortPointer const& _sort)
@@ -71,12 +101,17 @@ void SMTPortfolio::declareVariable(string const& _name, SortPointer const& _sort
 	solAssert(_sort, "");
 	for (auto const& s: m_solvers)
 		s->declareVariable(_name, _sort);
+	m_declarations.emplace_back(_name, _sort);
+	if (m_cache)
+		m_cache->declareVariable(_name, _sort);
 }
 
 void SMTPortfolio::addAssertion(smt::Expression const& _expr)
 {
 	for (auto const& s: m_solvers)
 		s->addAssertion(_expr);
+	if (m_cache)
+		m_cache->add("assert", _expr);
 }
 
 /*
@@ -110,6 +145,36 @@ void SMTPortfolio::addAssertion(smt::Expression const& _expr)
  *   If all solvers return ERROR, the result is ERROR.
 */
 pair<CheckResult, vector<string>> SMTPortfolio::check(vector<smt::Expression> const& _expressionsToEvaluate)
+{
+	h256 key;
+	if (m_cache)
+	{
+		key = m_cache->key("check", _expressionsToEvaluate);
+		if (auto answer = m_cache->lookup(key))
+			return *answer;
+	}
+
+	Answer answer;
+	if (m_mode == SMTPortfolioMode::Sequential || m_solvers.size() == 1)
+		answer = checkSequentially(_expressionsToEvaluate);
+	else
+		answer = checkConcurrently(_expressionsToEvaluate);
+
+	if (m_cache)
+		m_cache->store(key, answer);
+	return answer;
+}
+
+vector<string> SMTPortfolio::unhandledQueries()
+{
+	// This code assumes that the constructor guarantees that
+	// SmtLib2Interface is in position 0.
+	solAssert(!m_solvers.empty(), "");
+	solAssert(dynamic_cast<smt::SMTLib2Interface*>(m_solvers.front().get()), "");
+	return m_solvers.front()->unhandledQueries();
+}
+
+SMTPortfolio::Answer SMTPortfolio::checkSequentially(vector<smt::Expression> const& _expressionsToEvaluate)
 {
 	CheckResult lastResult = CheckResult::ERROR;
 	vector<string> finalValues;
@@ -137,13 +202,88 @@ pair<CheckResult, vector<string>> SMTPortfolio::check(vector<smt::Expression> co
 	return make_pair(lastResult, finalValues);
 }
 
-vector<string> SMTPortfolio::unhandledQueries()
+SMTPortfolio::Answer SMTPortfolio::checkConcurrently(vector<smt::Expression> const& _expressionsToEvaluate)
 {
-	// This code assumes that the constructor guarantees that
-	// SmtLib2Interface is in position 0.
-	solAssert(!m_solvers.empty(), "");
-	solAssert(dynamic_cast<smt::SMTLib2Interface*>(m_solvers.front().get()), "");
-	return m_solvers.front()->unhandledQueries();
+	mutex answersMutex;
+	condition_variable answerArrived;
+	// Indices of the solvers in the order in which their answers arrived.
+	vector<size_t> arrivalOrder;
+	vector<Answer> answers(m_solvers.size(), Answer{CheckResult::ERROR, {}});
+	vector<exception_ptr> errors(m_solvers.size());
+
+	auto runSolver = [&](size_t _index)
+	{
+		Answer answer{CheckResult::ERROR, {}};
+		exception_ptr error;
+		try
+		{
+			answer = m_solvers[_index]->check(_expressionsToEvaluate);
+		}
+		catch (...)
+		{
+			error = current_exception();
+		}
+		lock_guard<mutex> lock(answersMutex);
+		answers[_index] = move(answer);
+		errors[_index] = error;
+		arrivalOrder.push_back(_index);
+		answerArrived.notify_all();
+	};
+
+	// Only the solvers linked into the binary run on separate threads. SMTLib2Interface
+	// is the first solver and stays on the calling thread, since it may invoke the callback.
+	vector<thread> threads;
+	for (size_t i = 1; i < m_solvers.size(); ++i)
+		threads.emplace_back(runSolver, i);
+	runSolver(0);
+
+	Answer result{CheckResult::ERROR, {}};
+	auto decide = [&]() -> bool
+	{
+		vector<size_t> answered;
+		for (size_t index: arrivalOrder)
+			if (solverAnswered(answers[index].first))
+				answered.push_back(index);
+		bool allArrived = arrivalOrder.size() == m_solvers.size();
+		size_t const required = m_mode == SMTPortfolioMode::CrossCheck ? 2 : 1;
+		if (answered.size() >= required || (allArrived && !answered.empty()))
+		{
+			result = answers[answered.front()];
+			if (answered.size() > 1 && required > 1 && answers[answered[1]].first != result.first)
+				result.first = CheckResult::CONFLICTING;
+			return true;
+		}
+		if (allArrived)
+		{
+			for (size_t index: arrivalOrder)
+				if (answers[index].first == CheckResult::UNKNOWN)
+					result.first = CheckResult::UNKNOWN;
+			return true;
+		}
+		return false;
+	};
+
+	{
+		unique_lock<mutex> lock(answersMutex);
+		answerArrived.wait(lock, decide);
+		// The remaining solvers are interrupted repeatedly, since interrupting a solver
+		// that has not started its check yet has no effect.
+		while (!answerArrived.wait_for(
+			lock,
+			chrono::milliseconds(10),
+			[&]() { return arrivalOrder.size() == m_solvers.size(); }
+		))
+			for (size_t i = 0; i < m_solvers.size(); ++i)
+				if (find(arrivalOrder.begin(), arrivalOrder.end(), i) == arrivalOrder.end())
+					m_solvers[i]->interrupt();
+	}
+	for (thread& solverThread: threads)
+		solverThread.join();
+
+	for (exception_ptr const& error: errors)
+		if (error)
+			rethrow_exception(error);
+	return result;
 }
 
 bool SMTPortfolio::solverAnswered(CheckResult result)
@@ -18,6 +18,8 @@
 #pragma once
 
 
+#include <libsolidity/formal/ModelCheckerSettings.h>
+#include <libsolidity/formal/SMTResultCache.h>
 #include <libsolidity/formal/SolverInterface.h>
 #include <libsolidity/interface/ReadFile.h>
 #include <libdevcore/FixedHash.h>
@@ -45,7 +47,8 @@ public:
 	SMTPortfolio(
 		std::map<h256, std::string> const& _smtlib2Responses,
 		ReadCallback::Callback const& _smtCallback,
-		SMTSolverChoice _enabledSolvers
+		SMTSolverChoice _enabledSolvers,
+		ModelCheckerSettings const& _settings = ModelCheckerSettings()
 	);
 
 	void reset() override;
@@ -61,12 +64,31 @@ public:
 
 	std::vector<std::string> unhandledQueries() override;
 	unsigned solvers() override { return m_solvers.size(); }
+
+	/// @returns the names and sorts of all variables declared since the last reset,
+	/// in the order of their declaration.
+	std::vector<std::pair<std::string, SortPointer>> const& declarations() const { return m_declarations; }
 private:
+	using Answer = std::pair<CheckResult, std::vector<std::string>>;
+
+	/// Queries all solvers one after the other.
+	Answer checkSequentially(std::vector<smt::Expression> const& _expressionsToEvaluate);
+	/// Queries the solvers concurrently and interrupts the remaining ones as soon as
+	/// the answer is known.
+	Answer checkConcurrently(std::vector<smt::Expression> const& _expressionsToEvaluate);
+
 	static bool solverAnswered(CheckResult result);
 
+	SMTPortfolioMode m_mode;
+
 	std::vector<std::unique_ptr<smt::SolverInterface>> m_solvers;
 
 	std::vector<smt::Expression> m_assertions;
+
+	std::vector<std::pair<std::string, SortPointer>> m_declarations;
+
+	/// Answers of earlier compilations, if enabled.
+	std::unique_ptr<SMTResultCache> m_cache;
 };
 
 }
@@ -0,0 +1,191 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <libsolidity/formal/SMTResultCache.h>
+
+#include <libdevcore/CommonIO.h>
+#include <libdevcore/JSON.h>
+#include <libdevcore/Keccak256.h>
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+
+using namespace std;
+using namespace dev;
+using namespace dev::solidity::smt;
+
+namespace fs = boost::filesystem;
+
+SMTResultCache::SMTResultCache(string _directory, string _solvers):
+	m_directory(move(_directory)),
+	m_solvers(move(_solvers))
+{
+	reset();
+}
+
+void SMTResultCache::reset()
+{
+	m_scopes = {keccak256(m_solvers)};
+	m_names.clear();
+	m_hashes.clear();
+}
+
+void SMTResultCache::push()
+{
+	m_scopes.push_back(m_scopes.back());
+}
+
+void SMTResultCache::pop()
+{
+	solAssert(m_scopes.size() > 1, "");
+	m_scopes.pop_back();
+}
+
+void SMTResultCache::declareVariable(string const& _name, SortPointer const& _sort)
+{
+	solAssert(_sort, "");
+	size_t position = m_names.emplace(_name, m_names.size()).first->second;
+	update("declare " + to_string(position) + " " + sortText(*_sort));
+}
+
+void SMTResultCache::add(string const& _kind, Expression const& _expr)
+{
+	update(_kind + " " + hash(_expr).hex());
+}
+
+h256 SMTResultCache::key(string const& _kind, vector<Expression> const& _expressions)
+{
+	string data = m_scopes.back().hex() + " " + _kind;
+	for (Expression const& expr: _expressions)
+		data += " " + hash(expr).hex();
+	return keccak256(data);
+}
+
+optional<SMTResultCache::Answer> SMTResultCache::lookup(h256 const& _key) const
+{
+	fs::path path = fs::path(m_directory) / _key.hex();
+	boost::system::error_code error;
+	if (!fs::is_regular_file(path, error))
+		return {};
+
+	Json::Value entry;
+	if (!jsonParseStrict(readFileAsString(path.string()), entry) || !entry.isObject())
+		return {};
+	Answer answer;
+	if (entry["result"] == "sat")
+		answer.first = CheckResult::SATISFIABLE;
+	else if (entry["result"] == "unsat")
+		answer.first = CheckResult::UNSATISFIABLE;
+	else
+		return {};
+	if (!entry["values"].isArray())
+		return {};
+	for (Json::Value const& value: entry["values"])
+	{
+		if (!value.isString())
+			return {};
+		answer.second.push_back(value.asString());
+	}
+	return answer;
+}
+
+void SMTResultCache::store(h256 const& _key, Answer const& _answer) const
+{
+	if (_answer.first != CheckResult::SATISFIABLE && _answer.first != CheckResult::UNSATISFIABLE)
+		return;
+
+	Json::Value entry(Json::objectValue);
+	entry["result"] = _answer.first == CheckResult::SATISFIABLE ? "sat" : "unsat";
+	entry["values"] = Json::arrayValue;
+	for (string const& value: _answer.second)
+		entry["values"].append(value);
+
+	// Entries are written to a file of their own and then renamed, so that concurrent
+	// compilations never read a partially written entry.
+	boost::system::error_code error;
+	fs::create_directories(m_directory, error);
+	fs::path path = fs::path(m_directory) / _key.hex();
+	fs::path temporaryPath = fs::path(m_directory) / fs::unique_path(_key.hex() + ".%%%%-%%%%-%%%%");
+	{
+		ofstream file(temporaryPath.string(), ios::binary);
+		if (!file)
+			return;
+		file << jsonCompactPrint(entry);
+		if (!file)
+		{
+			file.close();
+			fs::remove(temporaryPath, error);
+			return;
+		}
+	}
+	fs::rename(temporaryPath, path, error);
+	if (error)
+		fs::remove(temporaryPath, error);
+}
+
+h256 SMTResultCache::hash(Expression const& _expr)
+{
+	auto it = m_hashes.find(_expr);
+	if (it != m_hashes.end())
+		return it->second;
+
+	string data;
+	if (m_names.count(_expr.name()))
+		data = "$" + to_string(m_names.at(_expr.name()));
+	else
+		data = _expr.name();
+	data += " " + sortText(*_expr.sort());
+	for (Expression const& argument: _expr.arguments())
+		data += " " + hash(argument).hex();
+	h256 result = keccak256(data);
+	m_hashes.emplace(_expr, result);
+	return result;
+}
+
+string SMTResultCache::sortText(Sort const& _sort) const
+{
+	switch (_sort.kind)
+	{
+	case Kind::Int:
+		return "Int";
+	case Kind::Bool:
+		return "Bool";
+	case Kind::Function:
+	{
+		auto const& functionSort = dynamic_cast<FunctionSort const&>(_sort);
+		string text = "(Function (";
+		for (SortPointer const& sort: functionSort.domain)
+			text += sortText(*sort) + " ";
+		return text + ") " + sortText(*functionSort.codomain) + ")";
+	}
+	case Kind::Array:
+	{
+		auto const& arraySort = dynamic_cast<ArraySort const&>(_sort);
+		return "(Array " + sortText(*arraySort.domain) + " " + sortText(*arraySort.range) + ")";
+	}
+	case Kind::Sort:
+		return "(Sort " + sortText(*dynamic_cast<SortSort const&>(_sort).inner) + ")";
+	}
+	solAssert(false, "");
+	return "";
+}
+
+void SMTResultCache::update(string const& _data)
+{
+	m_scopes.back() = keccak256(m_scopes.back().hex() + " " + _data);
+}
@@ -0,0 +1,91 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Cache of the answers of SMT solvers that persists across compilations.
+ */
+
+#pragma once
+
+#include <libsolidity/formal/SolverInterface.h>
+
+#include <libdevcore/FixedHash.h>
+
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace dev
+{
+namespace solidity
+{
+namespace smt
+{
+
+/**
+ * Stores the conclusive answers of SMT solvers in a directory, one file per query, so that
+ * queries that were already answered in an earlier compilation are not solved again.
+ *
+ * The cache follows the declarations and assertions of a solver and identifies a query by a
+ * hash of its contents, the solvers and their versions. Declared names are replaced by the
+ * position of their first declaration, so that a query does not depend on the IDs of the AST
+ * nodes and stays the same if only other parts of the sources change.
+ * Errors while reading or writing the directory are ignored, the query is solved instead.
+ */
+class SMTResultCache
+{
+public:
+	using Answer = std::pair<CheckResult, std::vector<std::string>>;
+
+	/// @param _solvers identifies the solvers that answer the queries, including their versions.
+	SMTResultCache(std::string _directory, std::string _solvers);
+
+	/// Forgets all declarations and assertions.
+	void reset();
+	void push();
+	void pop();
+
+	void declareVariable(std::string const& _name, SortPointer const& _sort);
+	/// Adds @a _expr in the role @a _kind, e.g. as assertion, to the query.
+	void add(std::string const& _kind, Expression const& _expr);
+
+	/// @returns the key of the current query extended by @a _kind and @a _expressions,
+	/// e.g. the values to evaluate.
+	h256 key(std::string const& _kind, std::vector<Expression> const& _expressions);
+
+	std::optional<Answer> lookup(h256 const& _key) const;
+	/// Stores @a _answer if it is conclusive.
+	void store(h256 const& _key, Answer const& _answer) const;
+
+private:
+	h256 hash(Expression const& _expr);
+	std::string sortText(Sort const& _sort) const;
+	void update(std::string const& _data);
+
+	std::string m_directory;
+	std::string m_solvers;
+	/// Hash of the declarations and assertions for every scope.
+	std::vector<h256> m_scopes;
+	/// Position of the first declaration of every declared name.
+	std::map<std::string, size_t> m_names;
+	ExpressionMap<h256> m_hashes;
+};
+
+}
+}
+}
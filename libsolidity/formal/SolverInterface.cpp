@@ -0,0 +1,159 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <libsolidity/formal/SolverInterface.h>
+
+#include <boost/functional/hash.hpp>
+
+#include <functional>
+#include <mutex>
+
+using namespace std;
+using namespace dev;
+using namespace dev::solidity::smt;
+
+namespace
+{
+
+/// Table of the names and nodes of all expressions that are alive.
+/// The entries only refer to the names and nodes weakly and the ones that expired are removed
+/// whenever the size of a table doubled, so the tables stay proportional to the live expressions.
+/// Expressions are created by the threads that check verification targets concurrently, so
+/// all accesses are guarded by a mutex.
+class ExpressionTable
+{
+public:
+	static ExpressionTable& instance()
+	{
+		static ExpressionTable table;
+		return table;
+	}
+
+	shared_ptr<ExpressionNode const> node(string _name, vector<Expression> _arguments, SortPointer _sort)
+	{
+		solAssert(_sort, "");
+		lock_guard<mutex> lock(m_mutex);
+
+		shared_ptr<string const> name = internName(move(_name));
+		size_t hash = boost::hash_value(name.get());
+		for (Expression const& argument: _arguments)
+			boost::hash_combine(hash, argument.node());
+		boost::hash_combine(hash, static_cast<int>(_sort->kind));
+
+		auto range = m_nodes.equal_range(hash);
+		for (auto it = range.first; it != range.second; ++it)
+			if (shared_ptr<ExpressionNode const> node = it->second.lock())
+				if (
+					node->name == name &&
+					node->arguments.size() == _arguments.size() &&
+					equal(
+						_arguments.begin(),
+						_arguments.end(),
+						node->arguments.begin(),
+						[](Expression const& _a, Expression const& _b) { return _a.node() == _b.node(); }
+					) &&
+					(node->sort == _sort || *node->sort == *_sort)
+				)
+					return node;
+
+		auto node = make_shared<ExpressionNode const>(ExpressionNode{move(name), move(_arguments), move(_sort), hash});
+		m_nodes.emplace(hash, node);
+		if (m_nodes.size() >= m_nodesSweepSize)
+		{
+			removeExpired(m_nodes);
+			m_nodesSweepSize = max(minimalSweepSize, 2 * m_nodes.size());
+		}
+		return node;
+	}
+
+private:
+	shared_ptr<string const> internName(string _name)
+	{
+		weak_ptr<string const>& entry = m_names[_name];
+		if (shared_ptr<string const> name = entry.lock())
+			return name;
+		auto name = make_shared<string const>(move(_name));
+		entry = name;
+		if (m_names.size() >= m_namesSweepSize)
+		{
+			removeExpired(m_names);
+			m_namesSweepSize = max(minimalSweepSize, 2 * m_names.size());
+		}
+		return name;
+	}
+
+	template <class Map>
+	static void removeExpired(Map& _map)
+	{
+		for (auto it = _map.begin(); it != _map.end();)
+			if (it->second.expired())
+				it = _map.erase(it);
+			else
+				++it;
+	}
+
+	static size_t constexpr minimalSweepSize = 1024;
+
+	mutex m_mutex;
+	unordered_map<string, weak_ptr<string const>> m_names;
+	unordered_multimap<size_t, weak_ptr<ExpressionNode const>> m_nodes;
+	size_t m_namesSweepSize = minimalSweepSize;
+	size_t m_nodesSweepSize = minimalSweepSize;
+};
+
+SortPointer const& simpleSort(Kind _kind)
+{
+	static SortPointer const boolSort = make_shared<Sort>(Kind::Bool);
+	static SortPointer const intSort = make_shared<Sort>(Kind::Int);
+	solAssert(_kind == Kind::Bool || _kind == Kind::Int, "");
+	return _kind == Kind::Bool ? boolSort : intSort;
+}
+
+}
+
+Expression::Expression(string _name, vector<Expression> _arguments, SortPointer _sort):
+	m_node(ExpressionTable::instance().node(move(_name), move(_arguments), move(_sort)))
+{
+}
+
+Expression::Expression(string _name, vector<Expression> _arguments, Kind _kind):
+	Expression(move(_name), move(_arguments), simpleSort(_kind))
+{
+}
+
+Expression Expression::substitute(unordered_map<string, Expression> const& _substitutions) const
+{
+	ExpressionMap<Expression> substituted;
+	function<Expression(Expression const&)> visit = [&](Expression const& _expr) -> Expression
+	{
+		if (_expr.arguments().empty())
+		{
+			auto it = _substitutions.find(_expr.name());
+			return it == _substitutions.end() ? _expr : it->second;
+		}
+		auto it = substituted.find(_expr);
+		if (it != substituted.end())
+			return it->second;
+		vector<Expression> arguments;
+		for (Expression const& argument: _expr.arguments())
+			arguments.push_back(visit(argument));
+		Expression result(_expr.name(), move(arguments), _expr.sort());
+		substituted.emplace(_expr, result);
+		return result;
+	};
+	return visit(*this);
+}
@@ -26,7 +26,9 @@
 #include <boost/noncopyable.hpp>
 #include <cstdio>
 #include <map>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace dev
@@ -147,7 +149,13 @@ struct SortSort: public Sort
 // Forward declaration.
 SortPointer smtSort(solidity::Type const& _type);
 
+struct ExpressionNode;
+
 /// C++ representation of an SMTLIB2 expression.
+/// Expressions are nodes of a DAG that are shared by all equal expressions ("hash-consing"),
+/// so copying an expression does not copy its arguments and equal subexpressions are
+/// stored only once. This also allows using the identity of the node as key of caches,
+/// see ExpressionMap.
 class Expression
 {
 	friend class SolverInterface;
@@ -164,6 +172,16 @@ public:
 	Expression& operator=(Expression const&) = default;
 	Expression& operator=(Expression&&) = default;
 
+	std::string const& name() const;
+	std::vector<Expression> const& arguments() const;
+	SortPointer const& sort() const;
+	/// @returns the node of this expression, which is the same for all equal expressions.
+	ExpressionNode const* node() const { return m_node.get(); }
+
+	/// @returns this expression with the variables (expressions without arguments) whose
+	/// names are keys of @a _substitutions replaced by the respective values.
+	Expression substitute(std::unordered_map<std::string, Expression> const& _substitutions) const;
+
 	bool hasCorrectArity() const
 	{
 		static std::map<std::string, unsigned> const operatorsArity{
@@ -186,13 +204,13 @@ public:
 			{"store", 3},
 			{"const_array", 2}
 		};
-		return operatorsArity.count(name) && operatorsArity.at(name) == arguments.size();
+		return operatorsArity.count(name()) && operatorsArity.at(name()) == arguments().size();
 	}
 
 	static Expression ite(Expression _condition, Expression _trueValue, Expression _falseValue)
 	{
-		solAssert(*_trueValue.sort == *_falseValue.sort, "");
-		SortPointer sort = _trueValue.sort;
+		solAssert(*_trueValue.sort() == *_falseValue.sort(), "");
+		SortPointer sort = _trueValue.sort();
 		return Expression("ite", std::vector<Expression>{
 			std::move(_condition), std::move(_trueValue), std::move(_falseValue)
 		}, std::move(sort));
@@ -211,11 +229,11 @@ public:
 	/// select is the SMT representation of an array index access.
 	static Expression select(Expression _array, Expression _index)
 	{
-		solAssert(_array.sort->kind == Kind::Array, "");
-		std::shared_ptr<ArraySort> arraySort = std::dynamic_pointer_cast<ArraySort>(_array.sort);
+		solAssert(_array.sort()->kind == Kind::Array, "");
+		std::shared_ptr<ArraySort> arraySort = std::dynamic_pointer_cast<ArraySort>(_array.sort());
 		solAssert(arraySort, "");
-		solAssert(_index.sort, "");
-		solAssert(*arraySort->domain == *_index.sort, "");
+		solAssert(_index.sort(), "");
+		solAssert(*arraySort->domain == *_index.sort(), "");
 		return Expression(
 			"select",
 			std::vector<Expression>{std::move(_array), std::move(_index)},
@@ -227,13 +245,13 @@ public:
 	/// The function is pure and returns the modified array.
 	static Expression store(Expression _array, Expression _index, Expression _element)
 	{
-		solAssert(_array.sort->kind == Kind::Array, "");
-		std::shared_ptr<ArraySort> arraySort = std::dynamic_pointer_cast<ArraySort>(_array.sort);
+		solAssert(_array.sort()->kind == Kind::Array, "");
+		std::shared_ptr<ArraySort> arraySort = std::dynamic_pointer_cast<ArraySort>(_array.sort());
 		solAssert(arraySort, "");
-		solAssert(_index.sort, "");
-		solAssert(_element.sort, "");
-		solAssert(*arraySort->domain == *_index.sort, "");
-		solAssert(*arraySort->range == *_element.sort, "");
+		solAssert(_index.sort(), "");
+		solAssert(_element.sort(), "");
+		solAssert(*arraySort->domain == *_index.sort(), "");
+		solAssert(*arraySort->range == *_element.sort(), "");
 		return Expression(
 			"store",
 			std::vector<Expression>{std::move(_array), std::move(_index), std::move(_element)},
@@ -243,12 +261,12 @@ public:
 
 	static Expression const_array(Expression _sort, Expression _value)
 	{
-		solAssert(_sort.sort->kind == Kind::Sort, "");
-		auto sortSort = std::dynamic_pointer_cast<SortSort>(_sort.sort);
+		solAssert(_sort.sort()->kind == Kind::Sort, "");
+		auto sortSort = std::dynamic_pointer_cast<SortSort>(_sort.sort());
 		auto arraySort = std::dynamic_pointer_cast<ArraySort>(sortSort->inner);
 		solAssert(sortSort && arraySort, "");
-		solAssert(_value.sort, "");
-		solAssert(*arraySort->range == *_value.sort, "");
+		solAssert(_value.sort(), "");
+		solAssert(*arraySort->range == *_value.sort(), "");
 		return Expression(
 			"const_array",
 			std::vector<Expression>{std::move(_sort), std::move(_value)},
@@ -315,24 +333,19 @@ public:
 	Expression operator()(std::vector<Expression> _arguments) const
 	{
 		solAssert(
-			sort->kind == Kind::Function,
+			sort()->kind == Kind::Function,
 			"Attempted function application to non-function."
 		);
-		auto fSort = dynamic_cast<FunctionSort const*>(sort.get());
+		auto fSort = dynamic_cast<FunctionSort const*>(sort().get());
 		solAssert(fSort, "");
-		return Expression(name, std::move(_arguments), fSort->codomain);
+		return Expression(name(), std::move(_arguments), fSort->codomain);
 	}
 
-	std::string name;
-	std::vector<Expression> arguments;
-	SortPointer sort;
-
 private:
 	/// Manual constructors, should only be used by SolverInterface and this class itself.
-	Expression(std::string _name, std::vector<Expression> _arguments, SortPointer _sort):
-		name(std::move(_name)), arguments(std::move(_arguments)), sort(std::move(_sort)) {}
-	Expression(std::string _name, std::vector<Expression> _arguments, Kind _kind):
-		Expression(std::move(_name), std::move(_arguments), std::make_shared<Sort>(_kind)) {}
+	/// They look up the node of an equal expression or create a new one.
+	Expression(std::string _name, std::vector<Expression> _arguments, SortPointer _sort);
+	Expression(std::string _name, std::vector<Expression> _arguments, Kind _kind);
 
 	explicit Expression(std::string _name, Kind _kind):
 		Expression(std::move(_name), std::vector<Expression>{}, _kind) {}
@@ -340,8 +353,39 @@ private:
 		Expression(std::move(_name), std::vector<Expression>{std::move(_arg)}, _kind) {}
 	Expression(std::string _name, Expression _arg1, Expression _arg2, Kind _kind):
 		Expression(std::move(_name), std::vector<Expression>{std::move(_arg1), std::move(_arg2)}, _kind) {}
+
+	std::shared_ptr<ExpressionNode const> m_node;
 };
 
+/// Node of the expression DAG. Nodes are only created by Expression and never modified.
+struct ExpressionNode
+{
+	/// The name, which is shared by all nodes with the same name.
+	std::shared_ptr<std::string const> name;
+	std::vector<Expression> arguments;
+	SortPointer sort;
+	size_t hash;
+};
+
+inline std::string const& Expression::name() const { return *m_node->name; }
+inline std::vector<Expression> const& Expression::arguments() const { return m_node->arguments; }
+inline SortPointer const& Expression::sort() const { return m_node->sort; }
+
+/// Hash and equality of expressions by the identity of their nodes, which coincides with
+/// structural equality. Note that Expression::operator== creates an equation instead.
+struct ExpressionHash
+{
+	size_t operator()(Expression const& _expression) const { return _expression.node()->hash; }
+};
+struct ExpressionIdentity
+{
+	bool operator()(Expression const& _a, Expression const& _b) const { return _a.node() == _b.node(); }
+};
+/// Map from expressions to values that are derived from them, for example their translation
+/// for a solver. The keys keep the nodes alive, so their addresses are not reused.
+template <class T>
+using ExpressionMap = std::unordered_map<Expression, T, ExpressionHash, ExpressionIdentity>;
+
 DEV_SIMPLE_EXCEPTION(SolverError);
 
 class SolverInterface
@@ -369,6 +413,11 @@ public:
 	virtual std::pair<CheckResult, std::vector<std::string>>
 	check(std::vector<Expression> const& _expressionsToEvaluate) = 0;
 
+	/// Asks a check that runs concurrently on another thread to stop, in which case it
+	/// returns UNKNOWN or ERROR. Has no effect if no check is running.
+	/// Has to be safe to call from any thread.
+	virtual void interrupt() {}
+
 	/// @returns a list of queries that the system was not able to respond to.
 	virtual std::vector<std::string> unhandledQueries() { return {}; }
 
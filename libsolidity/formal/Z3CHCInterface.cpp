@@ -24,11 +24,14 @@ using namespace std;
 using namespace dev;
 using namespace dev::solidity::smt;
 
-Z3CHCInterface::Z3CHCInterface():
+Z3CHCInterface::Z3CHCInterface(ModelCheckerSettings const& _settings):
 	m_z3Interface(make_shared<Z3Interface>()),
 	m_context(m_z3Interface->context()),
 	m_solver(*m_context)
 {
+	if (!_settings.cacheDirectory.empty())
+		m_cache = make_unique<SMTResultCache>(_settings.cacheDirectory, "z3-chc-" + Z3Interface::version());
+
 	// These need to be set globally.
 	z3::set_param("rewriter.pull_cheap_ite", true);
 	z3::set_param("rlimit", Z3Interface::resourceLimit);
@@ -50,11 +53,15 @@ void Z3CHCInterface::declareVariable(string const& _name, SortPointer const& _so
 {
 	solAssert(_sort, "");
 	m_z3Interface->declareVariable(_name, _sort);
+	if (m_cache)
+		m_cache->declareVariable(_name, _sort);
 }
 
 void Z3CHCInterface::registerRelation(Expression const& _expr)
 {
-	m_solver.register_relation(m_z3Interface->functions().at(_expr.name));
+	m_solver.register_relation(m_z3Interface->functions().at(_expr.name()));
+	if (m_cache)
+		m_cache->add("relation", _expr);
 }
 
 void Z3CHCInterface::addRule(Expression const& _expr, string const& _name)
@@ -70,10 +77,20 @@ void Z3CHCInterface::addRule(Expression const& _expr, string const& _name)
 		z3::expr boundRule = z3::forall(variables, rule);
 		m_solver.add_rule(boundRule, m_context->str_symbol(_name.c_str()));
 	}
+	if (m_cache)
+		m_cache->add("rule", _expr);
 }
 
 pair<CheckResult, vector<string>> Z3CHCInterface::query(Expression const& _expr)
 {
+	h256 key;
+	if (m_cache)
+	{
+		key = m_cache->key("query", {_expr});
+		if (auto answer = m_cache->lookup(key))
+			return *answer;
+	}
+
 	CheckResult result;
 	vector<string> values;
 	try
@@ -107,5 +124,7 @@ pair<CheckResult, vector<string>> Z3CHCInterface::query(Expression const& _expr)
 		values.clear();
 	}
 
+	if (m_cache)
+		m_cache->store(key, {result, values});
 	return make_pair(result, values);
 }
@@ -22,6 +22,8 @@
 #pragma once
 
 #include <libsolidity/formal/CHCSolverInterface.h>
+#include <libsolidity/formal/ModelCheckerSettings.h>
+#include <libsolidity/formal/SMTResultCache.h>
 #include <libsolidity/formal/Z3Interface.h>
 
 namespace dev
@@ -34,7 +36,7 @@ namespace smt
 class Z3CHCInterface: public CHCSolverInterface
 {
 public:
-	Z3CHCInterface();
+	explicit Z3CHCInterface(ModelCheckerSettings const& _settings = ModelCheckerSettings());
 
 	/// Forwards variable declaration to Z3Interface.
 	void declareVariable(std::string const& _name, SortPointer const& _sort) override;
@@ -54,6 +56,9 @@ private:
 	z3::context* m_context;
 	// Horn solver.
 	z3::fixedpoint m_solver;
+
+	/// Answers of earlier compilations, if enabled.
+	std::unique_ptr<SMTResultCache> m_cache;
 };
 
 }
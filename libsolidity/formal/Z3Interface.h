@@ -42,6 +42,7 @@ public:
 
 	void addAssertion(Expression const& _expr) override;
 	std::pair<CheckResult, std::vector<std::string>> check(std::vector<Expression> const& _expressionsToEvaluate) override;
+	void interrupt() override { m_context.interrupt(); }
 
 	z3::expr toZ3Expr(Expression const& _expr);
 
@@ -50,6 +51,9 @@ public:
 
 	z3::context* context() { return &m_context; }
 
+	/// @returns the version of the Z3 library.
+	static std::string version();
+
 	// Z3 "basic resources" limit.
 	// This is used to make the runs more deterministic and platform/machine independent.
 	// The tests start failing for Z3 with less than 20000000,
@@ -59,6 +63,9 @@ public:
 private:
 	void declareFunction(std::string const& _name, Sort const& _sort);
 
+	/// Translates @a _expr, using toZ3Expr for its arguments.
+	z3::expr createZ3Expr(Expression const& _expr);
+
 	z3::sort z3Sort(smt::Sort const& _sort);
 	z3::sort_vector z3Sort(std::vector<smt::SortPointer> const& _sorts);
 
@@ -67,6 +74,10 @@ private:
 
 	z3::context m_context;
 	z3::solver m_solver;
+
+	/// Translations of the expressions seen so far. They are invalidated when a
+	/// variable is declared again.
+	ExpressionMap<z3::expr> m_expressions;
 };
 
 }
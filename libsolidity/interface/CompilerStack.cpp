@@ -37,6 +37,7 @@
 #include <libsolidity/analysis/ViewPureChecker.h>
 
 #include <libsolidity/ast/AST.h>
+#include <libsolidity/ast/ASTSnapshot.h>
 #include <libsolidity/ast/TypeProvider.h>
 #include <libsolidity/codegen/Compiler.h>
 #include <libsolidity/formal/ModelChecker.h>
@@ -57,11 +58,13 @@
 #include <libyul/backends/evm/EVMDialect.h>
 #include <libyul/AssemblyStack.h>
 
+#include <liblangutil/ParallelReporting.h>
 #include <liblangutil/Scanner.h>
 #include <liblangutil/SemVerHandler.h>
 
 #include <libevmasm/Exceptions.h>
 
+#include <libdevcore/Parallel.h>
 #include <libdevcore/SwarmHash.h>
 #include <libdevcore/IpfsHash.h>
 #include <libdevcore/JSON.h>
@@ -140,6 +143,13 @@ void CompilerStack::setSMTSolverChoice(smt::SMTSolverChoice _enabledSMTSolvers)
 	m_enabledSMTSolvers = _enabledSMTSolvers;
 }
 
+void CompilerStack::setModelCheckerSettings(ModelCheckerSettings _settings)
+{
+	if (m_stackState >= ParsingPerformed)
+		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Must set model checker settings before parsing."));
+	m_modelCheckerSettings = _settings;
+}
+
 void CompilerStack::setLibraries(std::map<std::string, h160> const& _libraries)
 {
 	if (m_stackState >= ParsingPerformed)
@@ -190,6 +200,13 @@ void CompilerStack::addSMTLib2Response(h256 const& _hash, string const& _respons
 	m_smtlib2Responses[_hash] = _response;
 }
 
+void CompilerStack::setASTSnapshot(bytes _snapshot)
+{
+	if (m_stackState >= ParsingPerformed)
+		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Must set the AST snapshot before parsing."));
+	m_astSnapshot = move(_snapshot);
+}
+
 void CompilerStack::reset(bool _keepSettings)
 {
 	m_stackState = Empty;
@@ -197,12 +214,14 @@ void CompilerStack::reset(bool _keepSettings)
 	m_sources.clear();
 	m_smtlib2Responses.clear();
 	m_unhandledSMTLib2Queries.clear();
+	m_astSnapshot.clear();
 	if (!_keepSettings)
 	{
 		m_remappings.clear();
 		m_libraries.clear();
 		m_evmVersion = langutil::EVMVersion();
 		m_enabledSMTSolvers = smt::SMTSolverChoice::All();
+		m_modelCheckerSettings = ModelCheckerSettings{};
 		m_generateIR = false;
 		m_generateEWasm = false;
 		m_revertStrings = RevertStrings::Default;
@@ -234,34 +253,104 @@ bool CompilerStack::parse()
 	if (m_stackState != SourcesSet)
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Must call parse only after the SourcesSet state."));
 	m_errorReporter.clear();
-	ASTNode::resetID();
 
 	if (SemVerVersion{string(VersionString)}.isPrerelease())
 		m_errorReporter.warning("This is a pre-release compiler version, please do not use it in production.");
 
+	/// Parser of a single source with its own errors and node IDs,
+	/// so that sources can be parsed concurrently.
+	struct SourceParser
+	{
+		SourceParser(langutil::EVMVersion _evmVersion, bool _errorRecovery):
+			parser(errorReporter, _evmVersion, _errorRecovery) {}
+
+		ErrorList errors;
+		ErrorReporter errorReporter{errors};
+		IDDispenser nodeIDs;
+		Parser parser;
+	};
+
 	vector<string> sourcesToParse;
 	for (auto const& s: m_sources)
 		sourcesToParse.push_back(s.first);
-	for (size_t i = 0; i < sourcesToParse.size(); ++i)
+	ASTSnapshotReader snapshot(&m_astSnapshot);
+	// All sources known at the start of a round are parsed concurrently. Afterwards, the results
+	// are merged in the order of sourcesToParse and the imports are loaded, which starts the next
+	// round. This yields the same node IDs and errors as parsing one source after the other.
+	size_t lastNodeID = 0;
+	try
 	{
-		string const& path = sourcesToParse[i];
-		Source& source = m_sources[path];
-		source.scanner->reset();
-		source.ast = Parser(m_errorReporter, m_evmVersion, m_parserErrorRecovery).parse(source.scanner);
-		if (!source.ast)
-			solAssert(!Error::containsOnlyWarnings(m_errorReporter.errors()), "Parser returned null but did not report error.");
-		else
+		for (size_t roundStart = 0; roundStart < sourcesToParse.size();)
 		{
-			source.ast->annotation().path = path;
-			for (auto const& newSource: loadMissingSources(*source.ast, path))
+			size_t roundEnd = sourcesToParse.size();
+			vector<unique_ptr<SourceParser>> parsers;
+			for (size_t i = roundStart; i < roundEnd; ++i)
+				parsers.emplace_back(make_unique<SourceParser>(m_evmVersion, m_parserErrorRecovery));
+			// Sources contained in the snapshot are not parsed, their ASTs are loaded while merging,
+			// when the offset of their node IDs is known.
+			vector<char> inSnapshot(parsers.size(), false);
+			// m_sources is not modified during the round, so it can be accessed concurrently.
+			parallelFor(parsers.size(), [&](size_t _index) {
+				string const& path = sourcesToParse[roundStart + _index];
+				Source& source = m_sources.at(path);
+				SourceParser& sourceParser = *parsers[_index];
+				source.scanner->reset();
+				source.arena = make_unique<ASTArena>();
+				if (!m_astSnapshot.empty() && snapshot.contains(path, source.keccak256()))
+					inSnapshot[_index] = true;
+				else
+					source.ast = sourceParser.parser.parse(source.scanner, sourceParser.nodeIDs, source.arena.get());
+			});
+
+			for (size_t i = roundStart; i < roundEnd; ++i)
 			{
-				string const& newPath = newSource.first;
-				string const& newContents = newSource.second;
-				m_sources[newPath].scanner = make_shared<Scanner>(CharStream(newContents, newPath));
-				sourcesToParse.push_back(newPath);
+				string const& path = sourcesToParse[i];
+				Source& source = m_sources[path];
+				SourceParser& sourceParser = *parsers[i - roundStart];
+				if (inSnapshot[i - roundStart])
+				{
+					source.ast = snapshot.readAST(path, source.scanner, lastNodeID, *source.arena, m_evmVersion);
+					if (source.ast)
+						sourceParser.nodeIDs = IDDispenser(snapshot.nodeIDCount(path));
+					else
+					{
+						// The snapshot is damaged, so the source is parsed after all.
+						source.scanner->reset();
+						source.arena = make_unique<ASTArena>();
+						source.ast = sourceParser.parser.parse(source.scanner, sourceParser.nodeIDs, source.arena.get());
+					}
+				}
+				m_errorReporter.append(sourceParser.errors);
+				source.nodeIDOffset = lastNodeID;
+				source.nodeIDCount = sourceParser.nodeIDs.lastID();
+				source.parsedWithoutErrors = source.ast && sourceParser.errors.empty();
+				if (!source.ast)
+					solAssert(!Error::containsOnlyWarnings(sourceParser.errors), "Parser returned null but did not report error.");
+				else
+				{
+					sourceParser.parser.shiftNodeIDs(lastNodeID);
+					source.ast->annotation().path = path;
+					for (auto const& newSource: loadMissingSources(*source.ast, path))
+					{
+						string const& newPath = newSource.first;
+						string const& newContents = newSource.second;
+						m_sources[newPath].scanner = make_shared<Scanner>(CharStream(newContents, newPath));
+						sourcesToParse.push_back(newPath);
+					}
+				}
+				lastNodeID += sourceParser.nodeIDs.lastID();
 			}
+			roundStart = roundEnd;
 		}
 	}
+	catch (FatalError const&)
+	{
+		// Too many errors were reported while merging, some of the sources have not been
+		// merged yet and are dropped.
+		for (auto& source: m_sources)
+			source.second.ast.reset();
+	}
+	m_nodeIDs = IDDispenser(lastNodeID);
 
 	m_stackState = ParsingPerformed;
 	if (!Error::containsOnlyWarnings(m_errorReporter.errors()))
@@ -277,19 +366,33 @@ bool CompilerStack::analyze()
 
 	bool noErrors = true;
 
-	try
+	// The checks that only read the AST and the annotations of a single source unit are run for
+	// all source units concurrently, their errors are reported in the order of m_sourceOrder.
+	vector<SourceUnit const*> sourceUnits;
+	for (Source const* source: m_sourceOrder)
+		if (source->ast)
+			sourceUnits.push_back(source->ast.get());
+	auto checkSourceUnits = [&](auto const& _check)
 	{
-		SyntaxChecker syntaxChecker(m_errorReporter, m_optimiserSettings.runYulOptimiser);
-		for (Source const* source: m_sourceOrder)
-			if (source->ast && !syntaxChecker.checkSyntax(*source->ast))
-				noErrors = false;
-
-		DocStringAnalyser docStringAnalyser(m_errorReporter);
-		for (Source const* source: m_sourceOrder)
-			if (source->ast && !docStringAnalyser.analyseDocStrings(*source->ast))
-				noErrors = false;
+		return reportConcurrently(sourceUnits.size(), m_errorReporter, [&](size_t _index, ErrorReporter& _errorReporter) {
+			return _check(*sourceUnits[_index], _errorReporter);
+		});
+	};
 
-		m_globalContext = make_shared<GlobalContext>();
+	try
+	{
+		bool runYulOptimiser = m_optimiserSettings.runYulOptimiser;
+		if (!checkSourceUnits([&](SourceUnit const& _sourceUnit, ErrorReporter& _errorReporter) {
+			return SyntaxChecker(_errorReporter, runYulOptimiser).checkSyntax(_sourceUnit);
+		}))
+			noErrors = false;
+
+		if (!checkSourceUnits([](SourceUnit const& _sourceUnit, ErrorReporter& _errorReporter) {
+			return DocStringAnalyser(_errorReporter).analyseDocStrings(_sourceUnit);
+		}))
+			noErrors = false;
+
+		m_globalContext = make_shared<GlobalContext>(m_nodeIDs);
 		NameAndTypeResolver resolver(*m_globalContext, m_evmVersion, m_scopes, m_errorReporter);
 		for (Source const* source: m_sourceOrder)
 			if (source->ast && !resolver.registerDeclarations(*source->ast))
@@ -349,37 +452,33 @@ bool CompilerStack::analyze()
 		if (noErrors)
 		{
 			// Checks that can only be done when all types of all AST nodes are known.
-			PostTypeChecker postTypeChecker(m_errorReporter);
-			for (Source const* source: m_sourceOrder)
-				if (source->ast && !postTypeChecker.check(*source->ast))
-					noErrors = false;
+			if (!checkSourceUnits([](SourceUnit const& _sourceUnit, ErrorReporter& _errorReporter) {
+				return PostTypeChecker(_errorReporter).check(_sourceUnit);
+			}))
+				noErrors = false;
 		}
 
 		if (noErrors)
 		{
 			// Control flow graph generator and analyzer. It can check for issues such as
 			// variable is used before it is assigned to.
-			CFG cfg(m_errorReporter);
-			for (Source const* source: m_sourceOrder)
-				if (source->ast && !cfg.constructFlow(*source->ast))
-					noErrors = false;
-
-			if (noErrors)
-			{
-				ControlFlowAnalyzer controlFlowAnalyzer(cfg, m_errorReporter);
-				for (Source const* source: m_sourceOrder)
-					if (source->ast && !controlFlowAnalyzer.analyze(*source->ast))
-						noErrors = false;
-			}
+			// The graph of a source unit only contains the functions of that source unit.
+			if (!checkSourceUnits([](SourceUnit const& _sourceUnit, ErrorReporter& _errorReporter) {
+				CFG cfg(_errorReporter);
+				if (!cfg.constructFlow(_sourceUnit))
+					return false;
+				return ControlFlowAnalyzer(cfg, _errorReporter).analyze(_sourceUnit);
+			}))
+				noErrors = false;
 		}
 
 		if (noErrors)
 		{
 			// Checks for common mistakes. Only generates warnings.
-			StaticAnalyzer staticAnalyzer(m_errorReporter);
-			for (Source const* source: m_sourceOrder)
-				if (source->ast && !staticAnalyzer.analyze(*source->ast))
-					noErrors = false;
+			if (!checkSourceUnits([](SourceUnit const& _sourceUnit, ErrorReporter& _errorReporter) {
+				return StaticAnalyzer(_errorReporter).analyze(_sourceUnit);
+			}))
+				noErrors = false;
 		}
 
 		if (noErrors)
@@ -396,7 +495,13 @@ bool CompilerStack::analyze()
 
 		if (noErrors)
 		{
-			ModelChecker modelChecker(m_errorReporter, m_smtlib2Responses, m_readFile, m_enabledSMTSolvers);
+			ModelChecker modelChecker(
+				m_errorReporter,
+				m_smtlib2Responses,
+				m_readFile,
+				m_enabledSMTSolvers,
+				m_modelCheckerSettings
+			);
 			for (Source const* source: m_sourceOrder)
 				if (source->ast)
 					modelChecker.analyze(*source->ast);
@@ -810,6 +915,18 @@ SourceUnit const& CompilerStack::ast(string const& _sourceName) const
 	return *source(_sourceName).ast;
 }
 
+bytes CompilerStack::astSnapshot() const
+{
+	if (m_stackState < ParsingPerformed)
+		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Parsing not yet performed."));
+
+	ASTSnapshotWriter writer;
+	for (auto const& [path, source]: m_sources)
+		if (source.parsedWithoutErrors)
+			writer.addSource(path, source.keccak256(), *source.ast, source.nodeIDOffset, source.nodeIDCount);
+	return writer.snapshot();
+}
+
 ContractDefinition const& CompilerStack::contractDefinition(string const& _contractName) const
 {
 	if (m_stackState < AnalysisPerformed)
@@ -1472,34 +1589,46 @@ Json::Value CompilerStack::gasEstimates(string const& _contractName) const
 	{
 		/// External functions
 		ContractDefinition const& contract = contractDefinition(_contractName);
-		Json::Value externalFunctions(Json::objectValue);
+		vector<string> signatures;
 		for (auto it: contract.interfaceFunctions())
-		{
-			string sig = it.second->externalSignature();
-			externalFunctions[sig] = gasToJson(gasEstimator.functionalEstimation(*items, sig));
-		}
-
+			signatures.emplace_back(it.second->externalSignature());
+		vector<string> estimatedSignatures = signatures;
 		if (contract.fallbackFunction())
 			/// This needs to be set to an invalid signature in order to trigger the fallback,
 			/// without the shortcut (of CALLDATSIZE == 0), and therefore to receive the upper bound.
 			/// An empty string ("") would work to trigger the shortcut only.
-			externalFunctions[""] = gasToJson(gasEstimator.functionalEstimation(*items, "INVALID"));
+			estimatedSignatures.emplace_back("INVALID");
+		vector<Gas> externalGas = gasEstimator.functionalEstimation(*items, estimatedSignatures);
+
+		Json::Value externalFunctions(Json::objectValue);
+		for (size_t i = 0; i < signatures.size(); ++i)
+			externalFunctions[signatures[i]] = gasToJson(externalGas[i]);
+		if (contract.fallbackFunction())
+			externalFunctions[""] = gasToJson(externalGas.back());
 
 		if (!externalFunctions.empty())
 			output["external"] = externalFunctions;
 
 		/// Internal functions
-		Json::Value internalFunctions(Json::objectValue);
+		/// Exclude externally visible functions, constructor, fallback and receive ether function
+		vector<FunctionDefinition const*> functions;
 		for (auto const& it: contract.definedFunctions())
-		{
-			/// Exclude externally visible functions, constructor, fallback and receive ether function
-			if (it->isPartOfExternalInterface() || !it->isOrdinary())
-				continue;
+			if (!it->isPartOfExternalInterface() && it->isOrdinary())
+				functions.emplace_back(it);
+
+		vector<pair<size_t, FunctionDefinition const*>> entryPoints;
+		for (FunctionDefinition const* function: functions)
+			if (size_t entry = functionEntryPoint(_contractName, *function))
+				entryPoints.emplace_back(entry, function);
+		vector<Gas> internalGas = gasEstimator.functionalEstimation(*items, entryPoints);
 
-			size_t entry = functionEntryPoint(_contractName, *it);
-			GasEstimator::GasConsumption gas = GasEstimator::GasConsumption::infinite();
-			if (entry > 0)
-				gas = gasEstimator.functionalEstimation(*items, entry, *it);
+		Json::Value internalFunctions(Json::objectValue);
+		for (size_t i = 0, j = 0; i < functions.size(); ++i)
+		{
+			FunctionDefinition const* it = functions[i];
+			Gas gas = Gas::infinite();
+			if (j < entryPoints.size() && entryPoints[j].second == it)
+				gas = internalGas[j++];
 
 			/// TODO: This could move into a method shared with externalSignature()
 			FunctionType type(*it);
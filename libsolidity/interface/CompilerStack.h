@@ -23,10 +23,12 @@
 
 #pragma once
 
+#include <libsolidity/ast/ASTArena.h>
 #include <libsolidity/interface/ReadFile.h>
 #include <libsolidity/interface/OptimiserSettings.h>
 #include <libsolidity/interface/Version.h>
 #include <libsolidity/interface/DebugSettings.h>
+#include <libsolidity/formal/ModelCheckerSettings.h>
 #include <libsolidity/formal/SolverInterface.h>
 
 #include <liblangutil/ErrorReporter.h>
@@ -166,6 +168,9 @@ public:
 	/// Set which SMT solvers should be enabled.
 	void setSMTSolverChoice(smt::SMTSolverChoice _enabledSolvers);
 
+	/// Set the settings of the model checker (SMTChecker).
+	void setModelCheckerSettings(ModelCheckerSettings _settings);
+
 	/// Sets the requested contract names by source.
 	/// If empty, no filtering is performed and every contract
 	/// found in the supplied sources is compiled.
@@ -197,6 +202,11 @@ public:
 	/// Must be set before parsing.
 	void addSMTLib2Response(h256 const& _hash, std::string const& _response);
 
+	/// Sets a snapshot created by astSnapshot() in an earlier compilation. The ASTs of the sources
+	/// whose path and contents match are loaded from the snapshot instead of parsing them.
+	/// Must be set before parsing.
+	void setASTSnapshot(bytes _snapshot);
+
 	/// Parses all source units that were added
 	/// @returns false on error.
 	bool parse();
@@ -227,6 +237,10 @@ public:
 	/// @returns the parsed source unit with the supplied name.
 	SourceUnit const& ast(std::string const& _sourceName) const;
 
+	/// @returns a snapshot of the ASTs of all sources that were parsed without errors or warnings,
+	/// which can be passed to setASTSnapshot() of a later compilation.
+	bytes astSnapshot() const;
+
 	/// Helper function for logs printing. Do only use in error cases, it's quite expensive.
 	/// line and columns are numbered starting from 1 with following order:
 	/// start line, start column, end line, end column
@@ -319,11 +333,18 @@ private:
 	struct Source
 	{
 		std::shared_ptr<langutil::Scanner> scanner;
+		/// Memory of the nodes of the AST, declared before it so that it is destroyed after it.
+		std::unique_ptr<ASTArena> arena;
 		std::shared_ptr<SourceUnit> ast;
+		/// The nodes of the AST have the IDs from nodeIDOffset + 1 to nodeIDOffset + nodeIDCount.
+		size_t nodeIDOffset = 0;
+		size_t nodeIDCount = 0;
+		/// Whether the parser reported neither errors nor warnings for the source.
+		bool parsedWithoutErrors = false;
 		h256 mutable keccak256HashCached;
 		h256 mutable swarmHashCached;
 		std::string mutable ipfsUrlCached;
-		void reset() { *this = Source(); }
+		void reset() { ast.reset(); *this = Source(); }
 		h256 const& keccak256() const;
 		h256 const& swarmHash() const;
 		std::string const& ipfsUrl() const;
@@ -434,6 +455,7 @@ private:
 	RevertStrings m_revertStrings = RevertStrings::Default;
 	langutil::EVMVersion m_evmVersion;
 	smt::SMTSolverChoice m_enabledSMTSolvers;
+	ModelCheckerSettings m_modelCheckerSettings;
 	std::map<std::string, std::set<std::string>> m_requestedContractNames;
 	bool m_generateIR;
 	bool m_generateEWasm;
@@ -442,8 +464,11 @@ private:
 	/// "context:prefix=target"
 	std::vector<Remapping> m_remappings;
 	std::map<std::string const, Source> m_sources;
+	/// IDs of the AST nodes of the current compilation run.
+	IDDispenser m_nodeIDs;
 	std::vector<std::string> m_unhandledSMTLib2Queries;
 	std::map<h256, std::string> m_smtlib2Responses;
+	bytes m_astSnapshot;
 	std::shared_ptr<GlobalContext> m_globalContext;
 	std::vector<Source const*> m_sourceOrder;
 	/// This is updated during compilation.
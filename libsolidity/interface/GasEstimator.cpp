@@ -31,9 +31,12 @@
 #include <libevmasm/PathGasMeter.h>
 #include <libdevcore/Keccak256.h>
 
+#include <atomic>
 #include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <thread>
 
 using namespace std;
 using namespace dev;
@@ -128,10 +131,11 @@ map<ASTNode const*, GasMeter::GasConsumption> GasEstimator::breakToStatementLeve
 	return gasCosts;
 }
 
-GasEstimator::GasConsumption GasEstimator::functionalEstimation(
-	AssemblyItems const& _items,
-	string const& _signature
-) const
+namespace
+{
+
+/// @returns the state at the start of the code when calling the function with the given signature.
+shared_ptr<KnownState> initialState(string const& _signature, langutil::EVMVersion _evmVersion)
 {
 	auto state = make_shared<KnownState>();
 
@@ -142,7 +146,7 @@ GasEstimator::GasConsumption GasEstimator::functionalEstimation(
 		using Ids = vector<Id>;
 		Id hashValue = classes.find(u256(FixedHash<4>::Arith(FixedHash<4>(dev::keccak256(_signature)))));
 		Id calldata = classes.find(Instruction::CALLDATALOAD, Ids{classes.find(u256(0))});
-		if (!m_evmVersion.hasBitwiseShifting())
+		if (!_evmVersion.hasBitwiseShifting())
 			// div(calldataload(0), 1 << 224) equals to hashValue
 			classes.forceEqual(
 				hashValue,
@@ -164,20 +168,18 @@ GasEstimator::GasConsumption GasEstimator::functionalEstimation(
 		);
 	}
 
-	return PathGasMeter::estimateMax(_items, m_evmVersion, 0, state);
+	return state;
 }
 
-GasEstimator::GasConsumption GasEstimator::functionalEstimation(
-	AssemblyItems const& _items,
-	size_t const& _offset,
-	FunctionDefinition const& _function
-) const
+/// @returns the state at the entry point of the given internal function or nullptr if
+/// the gas consumption cannot be estimated.
+shared_ptr<KnownState> initialState(FunctionDefinition const& _function)
 {
 	auto state = make_shared<KnownState>();
 
 	unsigned parametersSize = CompilerUtils::sizeOnStack(_function.parameters());
 	if (parametersSize > 16)
-		return GasConsumption::infinite();
+		return nullptr;
 
 	// Store an invalid return value on the stack, so that the path estimator breaks upon reaching
 	// the return jump.
@@ -186,9 +188,112 @@ GasEstimator::GasConsumption GasEstimator::functionalEstimation(
 	if (parametersSize > 0)
 		state->feedItem(swapInstruction(parametersSize));
 
+	return state;
+}
+
+/// Calls @a _estimate(meter, i) for every i smaller than @a _count on a pool of threads.
+/// Every thread uses its own path gas meter for all of its estimations.
+template <class Estimate>
+void estimateConcurrently(
+	AssemblyItems const& _items,
+	langutil::EVMVersion _evmVersion,
+	size_t _count,
+	Estimate const& _estimate
+)
+{
+	if (_count == 0)
+		return;
+
+	atomic<size_t> nextIndex{0};
+	exception_ptr error;
+	mutex errorMutex;
+	auto worker = [&]()
+	{
+		try
+		{
+			PathGasMeter meter(_items, _evmVersion);
+			for (size_t i = nextIndex++; i < _count; i = nextIndex++)
+				_estimate(meter, i);
+		}
+		catch (...)
+		{
+			lock_guard<mutex> lock(errorMutex);
+			if (!error)
+				error = current_exception();
+		}
+	};
+
+	size_t threadCount = min<size_t>(_count, max(1u, thread::hardware_concurrency()));
+	vector<thread> threads;
+	for (size_t i = 1; i < threadCount; ++i)
+		threads.emplace_back(worker);
+	worker();
+	for (thread& t: threads)
+		t.join();
+	if (error)
+		rethrow_exception(error);
+}
+
+}
+
+GasEstimator::GasConsumption GasEstimator::functionalEstimation(
+	AssemblyItems const& _items,
+	string const& _signature
+) const
+{
+	return PathGasMeter::estimateMax(_items, m_evmVersion, 0, initialState(_signature, m_evmVersion));
+}
+
+GasEstimator::GasConsumption GasEstimator::functionalEstimation(
+	AssemblyItems const& _items,
+	size_t const& _offset,
+	FunctionDefinition const& _function
+) const
+{
+	shared_ptr<KnownState> state = initialState(_function);
+	if (!state)
+		return GasConsumption::infinite();
 	return PathGasMeter::estimateMax(_items, m_evmVersion, _offset, state);
 }
 
+vector<GasEstimator::GasConsumption> GasEstimator::functionalEstimation(
+	AssemblyItems const& _items,
+	vector<string> const& _signatures
+) const
+{
+	vector<shared_ptr<KnownState>> states;
+	for (string const& signature: _signatures)
+		states.emplace_back(initialState(signature, m_evmVersion));
+
+	vector<GasConsumption> gas(_signatures.size());
+	estimateConcurrently(_items, m_evmVersion, states.size(), [&](PathGasMeter& _meter, size_t _i)
+	{
+		gas[_i] = _meter.estimateMax(0, states[_i]);
+	});
+	return gas;
+}
+
+vector<GasEstimator::GasConsumption> GasEstimator::functionalEstimation(
+	AssemblyItems const& _items,
+	vector<pair<size_t, FunctionDefinition const*>> const& _functions
+) const
+{
+	// The initial states query the types of the parameters, which is not thread-safe.
+	vector<shared_ptr<KnownState>> states;
+	for (auto const& function: _functions)
+		states.emplace_back(initialState(*function.second));
+
+	vector<GasConsumption> gas(_functions.size());
+	estimateConcurrently(_items, m_evmVersion, states.size(), [&](PathGasMeter& _meter, size_t _i)
+	{
+		if (states[_i])
+			gas[_i] = _meter.estimateMax(_functions[_i].first, states[_i]);
+		else
+			gas[_i] = GasConsumption::infinite();
+	});
+	return gas;
+}
+
 set<ASTNode const*> GasEstimator::finestNodesAtLocation(
 	vector<ASTNode const*> const& _roots
 )
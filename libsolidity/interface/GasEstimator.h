@@ -81,6 +81,24 @@ public:
 		FunctionDefinition const& _function
 	) const;
 
+	/// @returns the estimated gas consumption by each of the (public or external) functions with
+	/// the given signatures, in the same order.
+	/// The estimations are performed concurrently and yield the same results as the
+	/// single-function variant.
+	std::vector<GasConsumption> functionalEstimation(
+		eth::AssemblyItems const& _items,
+		std::vector<std::string> const& _signatures
+	) const;
+
+	/// @returns the estimated gas consumption by each of the given functions, which start at the
+	/// given offsets into the list of assembly items, in the same order.
+	/// The estimations are performed concurrently and yield the same results as the
+	/// single-function variant.
+	std::vector<GasConsumption> functionalEstimation(
+		eth::AssemblyItems const& _items,
+		std::vector<std::pair<size_t, FunctionDefinition const*>> const& _functions
+	) const;
+
 private:
 	/// @returns the set of AST nodes which are the finest nodes at their location.
 	static std::set<ASTNode const*> finestNodesAtLocation(std::vector<ASTNode const*> const& _roots);
@@ -42,7 +42,8 @@ public:
 	enum class Kind
 	{
 		ReadFile,
-		SMTQuery
+		SMTQuery,
+		SMTSession
 	};
 
 	static std::string kindString(Kind _kind)
@@ -53,6 +54,8 @@ public:
 			return "source";
 		case Kind::SMTQuery:
 			return "smt-query";
+		case Kind::SMTSession:
+			return "smt-session";
 		default:
 			solAssert(false, "");
 		}
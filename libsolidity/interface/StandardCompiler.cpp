@@ -22,6 +22,7 @@
 
 #include <libsolidity/interface/StandardCompiler.h>
 
+#include <libsolidity/ast/ASTBinaryConverter.h>
 #include <libsolidity/ast/ASTJsonConverter.h>
 #include <libyul/AssemblyStack.h>
 #include <libyul/Exceptions.h>
@@ -35,6 +36,7 @@
 
 #include <algorithm>
 #include <optional>
+#include <sstream>
 
 using namespace std;
 using namespace dev;
@@ -351,7 +353,7 @@ std::optional<Json::Value> checkAuxiliaryInputKeys(Json::Value const& _input)
 
 std::optional<Json::Value> checkSettingsKeys(Json::Value const& _input)
 {
-	static set<string> keys{"parserErrorRecovery", "debug", "evmVersion", "libraries", "metadata", "optimizer", "outputSelection", "remappings"};
+	static set<string> keys{"parserErrorRecovery", "debug", "evmVersion", "libraries", "metadata", "modelChecker", "optimizer", "outputSelection", "remappings"};
 	return checkKeys(_input, keys, "settings");
 }
 
@@ -670,6 +672,51 @@ boost::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompile
 		}
 	}
 
+	if (settings.isMember("modelChecker"))
+	{
+		Json::Value const& modelChecker = settings["modelChecker"];
+		if (auto result = checkKeys(modelChecker, {"bmcSummaries", "bmcThreads", "cacheDirectory", "portfolio", "smtlib2Sessions"}, "settings.modelChecker"))
+			return *result;
+
+		if (modelChecker.isMember("portfolio"))
+		{
+			if (!modelChecker["portfolio"].isString())
+				return formatFatalError("JSONError", "settings.modelChecker.portfolio must be a string.");
+			std::optional<SMTPortfolioMode> portfolioMode = portfolioModeFromString(modelChecker["portfolio"].asString());
+			if (!portfolioMode)
+				return formatFatalError("JSONError", "Invalid value for settings.modelChecker.portfolio.");
+			ret.modelCheckerSettings.portfolioMode = *portfolioMode;
+		}
+
+		if (modelChecker.isMember("bmcThreads"))
+		{
+			if (!modelChecker["bmcThreads"].isUInt())
+				return formatFatalError("JSONError", "settings.modelChecker.bmcThreads must be an unsigned number.");
+			ret.modelCheckerSettings.bmcThreads = modelChecker["bmcThreads"].asUInt();
+		}
+
+		if (modelChecker.isMember("bmcSummaries"))
+		{
+			if (!modelChecker["bmcSummaries"].isBool())
+				return formatFatalError("JSONError", "settings.modelChecker.bmcSummaries must be a Boolean.");
+			ret.modelCheckerSettings.bmcSummaries = modelChecker["bmcSummaries"].asBool();
+		}
+
+		if (modelChecker.isMember("cacheDirectory"))
+		{
+			if (!modelChecker["cacheDirectory"].isString())
+				return formatFatalError("JSONError", "settings.modelChecker.cacheDirectory must be a string.");
+			ret.modelCheckerSettings.cacheDirectory = modelChecker["cacheDirectory"].asString();
+		}
+
+		if (modelChecker.isMember("smtlib2Sessions"))
+		{
+			if (!modelChecker["smtlib2Sessions"].isBool())
+				return formatFatalError("JSONError", "settings.modelChecker.smtlib2Sessions must be a Boolean.");
+			ret.modelCheckerSettings.smtlib2Sessions = modelChecker["smtlib2Sessions"].asBool();
+		}
+	}
+
 	if (settings.isMember("remappings") && !settings["remappings"].isArray())
 		return formatFatalError("JSONError", "\"settings.remappings\" must be an array of strings.");
 
@@ -773,6 +820,7 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 	compilerStack.setRemappings(_inputsAndSettings.remappings);
 	compilerStack.setOptimiserSettings(std::move(_inputsAndSettings.optimiserSettings));
 	compilerStack.setRevertStringBehaviour(_inputsAndSettings.revertStrings);
+	compilerStack.setModelCheckerSettings(_inputsAndSettings.modelCheckerSettings);
 	compilerStack.setLibraries(_inputsAndSettings.libraries);
 	compilerStack.useMetadataLiteralSources(_inputsAndSettings.metadataLiteralSources);
 	compilerStack.setMetadataHash(_inputsAndSettings.metadataHash);
@@ -926,6 +974,8 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 			sourceResult["ast"] = ASTJsonConverter(false, compilerStack.sourceIndices()).toJson(compilerStack.ast(sourceName));
 		if (isArtifactRequested(_inputsAndSettings.outputSelection, sourceName, "", "legacyAST", wildcardMatchesExperimental))
 			sourceResult["legacyAST"] = ASTJsonConverter(true, compilerStack.sourceIndices()).toJson(compilerStack.ast(sourceName));
+		if (isArtifactRequested(_inputsAndSettings.outputSelection, sourceName, "", "binaryAST", wildcardMatchesExperimental))
+			sourceResult["binaryAST"] = toHex(ASTBinaryConverter(compilerStack.sourceIndices()).toBinary(compilerStack.ast(sourceName)));
 		output["sources"][sourceName] = sourceResult;
 	}
 
@@ -1026,6 +1076,8 @@ Json::Value StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 		return formatFatalError("JSONError", "Field \"settings.libraries\" cannot be used for Yul.");
 	if (_inputsAndSettings.revertStrings != RevertStrings::Default)
 		return formatFatalError("JSONError", "Field \"settings.debug.revertStrings\" cannot be used for Yul.");
+	if (_inputsAndSettings.modelCheckerSettings != ModelCheckerSettings())
+		return formatFatalError("JSONError", "Field \"settings.modelChecker\" cannot be used for Yul.");
 
 	Json::Value output = Json::objectValue;
 
@@ -1128,17 +1180,28 @@ Json::Value StandardCompiler::compile(Json::Value const& _input) noexcept
 }
 
 string StandardCompiler::compile(string const& _input) noexcept
+{
+	ostringstream output;
+	compile(_input, output);
+	return output.str();
+}
+
+void StandardCompiler::compile(string const& _input, ostream& _output) noexcept
 {
 	Json::Value input;
 	string errors;
 	try
 	{
 		if (!jsonParseStrict(_input, input, &errors))
-			return jsonCompactPrint(formatFatalError("JSONError", errors));
+		{
+			jsonCompactPrint(formatFatalError("JSONError", errors), _output);
+			return;
+		}
 	}
 	catch (...)
 	{
-		return "{\"errors\":[{\"type\":\"JSONError\",\"component\":\"general\",\"severity\":\"error\",\"message\":\"Error parsing input JSON.\"}]}";
+		_output << "{\"errors\":[{\"type\":\"JSONError\",\"component\":\"general\",\"severity\":\"error\",\"message\":\"Error parsing input JSON.\"}]}";
+		return;
 	}
 
 	// cout << "Input: " << input.toStyledString() << endl;
@@ -1147,10 +1210,10 @@ string StandardCompiler::compile(string const& _input) noexcept
 
 	try
 	{
-		return jsonCompactPrint(output);
+		jsonCompactPrint(output, _output);
 	}
 	catch (...)
 	{
-		return "{\"errors\":[{\"type\":\"JSONError\",\"component\":\"general\",\"severity\":\"error\",\"message\":\"Error writing output JSON.\"}]}";
+		_output << "{\"errors\":[{\"type\":\"JSONError\",\"component\":\"general\",\"severity\":\"error\",\"message\":\"Error writing output JSON.\"}]}";
 	}
 }
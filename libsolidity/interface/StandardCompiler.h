@@ -25,6 +25,7 @@
 #include <libsolidity/interface/CompilerStack.h>
 
 #include <optional>
+#include <ostream>
 #include <boost/variant.hpp>
 
 namespace dev
@@ -54,6 +55,9 @@ public:
 	/// Parses input as JSON and peforms the above processing steps, returning a serialized JSON
 	/// output. Parsing errors are returned as regular errors.
 	std::string compile(std::string const& _input) noexcept;
+	/// Parses input as JSON and peforms the above processing steps, writing the serialized JSON
+	/// output directly to @a _output.
+	void compile(std::string const& _input, std::ostream& _output) noexcept;
 
 private:
 	struct InputsAndSettings
@@ -66,6 +70,7 @@ private:
 		langutil::EVMVersion evmVersion;
 		std::vector<CompilerStack::Remapping> remappings;
 		RevertStrings revertStrings = RevertStrings::Default;
+		ModelCheckerSettings modelCheckerSettings;
 		OptimiserSettings optimiserSettings = OptimiserSettings::minimal();
 		std::map<std::string, h160> libraries;
 		bool metadataLiteralSources = false;
@@ -31,6 +31,7 @@
 #include <liblangutil/SourceLocation.h>
 #include <libyul/backends/evm/EVMDialect.h>
 #include <cctype>
+#include <mutex>
 #include <vector>
 
 using namespace std;
@@ -46,9 +47,9 @@ namespace solidity
 class Parser::ASTNodeFactory
 {
 public:
-	explicit ASTNodeFactory(Parser const& _parser):
+	explicit ASTNodeFactory(Parser& _parser):
 		m_parser(_parser), m_location{_parser.position(), -1, _parser.source()} {}
-	ASTNodeFactory(Parser const& _parser, ASTPointer<ASTNode> const& _childNode):
+	ASTNodeFactory(Parser& _parser, ASTPointer<ASTNode> const& _childNode):
 		m_parser(_parser), m_location{_childNode->location()} {}
 
 	void markEndPosition() { m_location.end = m_parser.endPosition(); }
@@ -63,22 +64,41 @@ public:
 		solAssert(m_location.source, "");
 		if (m_location.end < 0)
 			markEndPosition();
-		return make_shared<NodeType>(m_location, std::forward<Args>(_args)...);
+		size_t id = m_parser.m_nodeIDs->next();
+		ASTPointer<NodeType> node;
+		if (!m_parser.m_arena)
+			node = make_shared<NodeType>(id, m_location, std::forward<Args>(_args)...);
+		else
+		{
+			// Allocating the annotation right away places it next to the node.
+			node = allocate_shared<NodeType>(
+				ASTArenaAllocator<NodeType>(*m_parser.m_arena),
+				id,
+				m_location,
+				std::forward<Args>(_args)...
+			);
+			node->createAnnotationIn(*m_parser.m_arena);
+		}
+		m_parser.m_createdNodes.emplace_back(node);
+		return node;
 	}
 
 	SourceLocation const& location() const noexcept { return m_location; }
 
 private:
-	Parser const& m_parser;
+	Parser& m_parser;
 	SourceLocation m_location;
 };
 
-ASTPointer<SourceUnit> Parser::parse(shared_ptr<Scanner> const& _scanner)
+ASTPointer<SourceUnit> Parser::parse(shared_ptr<Scanner> const& _scanner, IDDispenser& _nodeIDs, ASTArena* _arena)
 {
 	try
 	{
 		m_recursionDepth = 0;
 		m_scanner = _scanner;
+		m_nodeIDs = &_nodeIDs;
+		m_arena = _arena;
+		m_createdNodes.clear();
 		ASTNodeFactory nodeFactory(*this);
 		vector<ASTPointer<ASTNode>> nodes;
 		while (m_scanner->currentToken() != Token::EOS)
@@ -118,6 +138,13 @@ ASTPointer<SourceUnit> Parser::parse(shared_ptr<Scanner> const& _scanner)
 	}
 }
 
+void Parser::shiftNodeIDs(size_t _offset)
+{
+	for (weak_ptr<ASTNode> const& createdNode: m_createdNodes)
+		if (ASTPointer<ASTNode> node = createdNode.lock())
+			node->m_id += _offset;
+}
+
 void Parser::parsePragmaVersion(SourceLocation const& _location, vector<Token> const& _tokens, vector<string> const& _literals)
 {
 	SemVerMatchExpressionParser parser(_tokens, _literals);
@@ -153,7 +180,7 @@ ASTPointer<PragmaDirective> Parser::parsePragmaDirective()
 			parserError("Token incompatible with Solidity parser as part of pragma directive.");
 		else
 		{
-			string literal = m_scanner->currentLiteral();
+			string literal{m_scanner->currentLiteral()};
 			if (literal.empty() && TokenTraits::toString(token))
 				literal = TokenTraits::toString(token);
 			literals.push_back(literal);
@@ -1174,12 +1201,20 @@ ASTPointer<Statement> Parser::parseStatement()
 	return statement;
 }
 
+namespace
+{
+/// Guards parsing inline assembly, because the dialects and the YulString repository are
+/// shared by all parsers and are not thread-safe.
+mutex inlineAssemblyMutex;
+}
+
 ASTPointer<InlineAssembly> Parser::parseInlineAssembly(ASTPointer<ASTString> const& _docString)
 {
 	RecursionGuard recursionGuard(*this);
 	SourceLocation location{position(), -1, source()};
 
 	expectToken(Token::Assembly);
+	lock_guard<mutex> lock(inlineAssemblyMutex);
 	yul::Dialect const& dialect = yul::EVMDialect::strictAssemblyForEVM(m_evmVersion);
 	if (m_scanner->currentToken() == Token::StringLiteral)
 	{
@@ -1195,7 +1230,9 @@ ASTPointer<InlineAssembly> Parser::parseInlineAssembly(ASTPointer<ASTString> con
 		BOOST_THROW_EXCEPTION(FatalError());
 
 	location.end = block->location.end;
-	return make_shared<InlineAssembly>(location, _docString, dialect, block);
+	ASTNodeFactory nodeFactory(*this);
+	nodeFactory.setLocation(location);
+	return nodeFactory.createNode<InlineAssembly>(_docString, dialect, block);
 }
 
 ASTPointer<IfStatement> Parser::parseIfStatement(ASTPointer<ASTString> const& _docString)
@@ -1785,7 +1822,7 @@ ASTPointer<Expression> Parser::parsePrimaryExpression()
 	case Token::StringLiteral:
 	case Token::HexStringLiteral:
 	{
-		string literal = m_scanner->currentLiteral();
+		string literal{m_scanner->currentLiteral()};
 		Token firstToken = m_scanner->currentToken();
 		while (m_scanner->peekNextToken() == firstToken)
 		{
@@ -2082,10 +2119,21 @@ ASTPointer<ASTString> Parser::expectIdentifierToken()
 
 ASTPointer<ASTString> Parser::getLiteralAndAdvance()
 {
-	ASTPointer<ASTString> identifier = make_shared<ASTString>(m_scanner->currentLiteral());
+	ASTPointer<ASTString> identifier = intern(m_scanner->currentLiteral());
 	m_scanner->next();
 	return identifier;
 }
 
+ASTPointer<ASTString> Parser::intern(string_view _value)
+{
+	auto it = m_internedStrings.find(_value);
+	if (it == m_internedStrings.end())
+	{
+		string value{_value};
+		it = m_internedStrings.emplace(value, make_shared<ASTString>(value)).first;
+	}
+	return it->second;
+}
+
 }
 }
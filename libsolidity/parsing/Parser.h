@@ -26,6 +26,9 @@
 #include <liblangutil/ParserBase.h>
 #include <liblangutil/EVMVersion.h>
 
+#include <map>
+#include <string_view>
+
 namespace langutil
 {
 class Scanner;
@@ -48,7 +51,18 @@ public:
 		m_evmVersion(_evmVersion)
 	{}
 
-	ASTPointer<SourceUnit> parse(std::shared_ptr<langutil::Scanner> const& _scanner);
+	/// Parses the source unit provided by @a _scanner. The IDs of the nodes are taken from @a _nodeIDs.
+	/// If @a _arena is given, the nodes and their annotations are allocated from it and it has to
+	/// outlive the returned AST.
+	ASTPointer<SourceUnit> parse(
+		std::shared_ptr<langutil::Scanner> const& _scanner,
+		IDDispenser& _nodeIDs,
+		ASTArena* _arena = nullptr
+	);
+	/// Adds @a _offset to the IDs of all nodes created by the last call to parse().
+	/// Allows sources to be parsed independently with their own IDDispenser and to assign
+	/// their final IDs afterwards.
+	void shiftNodeIDs(size_t _offset);
 
 private:
 	class ASTNodeFactory;
@@ -192,6 +206,9 @@ private:
 
 	ASTPointer<ASTString> expectIdentifierToken();
 	ASTPointer<ASTString> getLiteralAndAdvance();
+	/// @returns a string with the contents @a _value. Equal strings share a single instance
+	/// within the source unit.
+	ASTPointer<ASTString> intern(std::string_view _value);
 	///@}
 
 	/// Creates an empty ParameterList at the current location (used if parameters can be omitted).
@@ -200,6 +217,13 @@ private:
 	/// Flag that signifies whether '_' is parsed as a PlaceholderStatement or a regular identifier.
 	bool m_insideModifier = false;
 	langutil::EVMVersion m_evmVersion;
+	IDDispenser* m_nodeIDs = nullptr;
+	ASTArena* m_arena = nullptr;
+	/// All nodes created during the current call to parse(), see shiftNodeIDs().
+	/// Nodes discarded by the parser have expired.
+	std::vector<std::weak_ptr<ASTNode>> m_createdNodes;
+	/// Names and literals of the current source unit, see intern().
+	std::map<std::string, ASTPointer<ASTString>, std::less<>> m_internedStrings;
 };
 
 }
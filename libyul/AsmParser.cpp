@@ -349,7 +349,7 @@ Parser::ElementaryOperation Parser::parseElementaryOperation()
 			kind = LiteralKind::String;
 			break;
 		case Token::Number:
-			if (!isValidNumberLiteral(currentLiteral()))
+			if (!isValidNumberLiteral(string(currentLiteral())))
 				fatalParserError("Invalid number literal.");
 			kind = LiteralKind::Number;
 			break;
@@ -21,8 +21,10 @@
 #include <libyul/backends/evm/ConstantOptimiser.h>
 
 #include <libyul/optimiser/ASTCopier.h>
+#include <libyul/optimiser/NameDispenser.h>
 #include <libyul/backends/evm/EVMMetrics.h>
 #include <libyul/AsmData.h>
+#include <libyul/Object.h>
 #include <libyul/Utilities.h>
 
 #include <libdevcore/CommonData.h>
@@ -107,6 +109,136 @@ void ConstantOptimiser::visit(Expression& _e)
 		ASTModifier::visit(_e);
 }
 
+void ConstantDataTable::run(
+	EVMDialect const& _dialect,
+	GasMeter const& _meter,
+	Object& _object,
+	NameDispenser& _dispenser
+)
+{
+	yulAssert(_dialect.providesObjectAccess(), "");
+	yulAssert(_object.code, "");
+
+	ConstantDataTable table{_dialect, _meter};
+	table(*_object.code);
+
+	// Rough estimates for the code of a call to the helper function (push return label,
+	// push data offset, push function label, jump, return label) and for the helper itself.
+	size_t const callSiteBytes = 14;
+	size_t const callSiteRunGas = 18;
+	size_t const helperFunctionBytes = 26;
+	size_t const helperFunctionRunGas = 70;
+
+	set<YulString> const existingNames = _object.dataNames();
+	map<u256, Representation> cache;
+	size_t savings = 0;
+	size_t dataNameCounter = 0;
+	for (auto const& [value, occurrences]: table.m_occurrences)
+	{
+		// Fills the cache with the cheapest representation the ConstantOptimiser would choose.
+		RepresentationFinder(_dialect, _meter, {}, cache).tryFindRepresentation(value);
+		size_t bestCosts = cache.at(value).cost * occurrences;
+		size_t tableCosts =
+			_meter.codeCosts(callSiteRunGas + helperFunctionRunGas, callSiteBytes) * occurrences +
+			_meter.dataCosts(toBigEndian(value));
+		if (tableCosts < bestCosts)
+		{
+			// Data names are string literals and thus limited to 32 bytes.
+			YulString dataName;
+			do
+				dataName = YulString{"constant_" + to_string(dataNameCounter++)};
+			while (existingNames.count(dataName));
+			table.m_dataNames[value] = dataName;
+			savings += bestCosts - tableCosts;
+		}
+	}
+	if (table.m_dataNames.empty() || savings <= _meter.codeCosts(0, helperFunctionBytes))
+		return;
+
+	for (auto const& [value, dataName]: table.m_dataNames)
+	{
+		_object.subIndexByName[dataName] = _object.subObjects.size();
+		_object.subObjects.emplace_back(make_shared<Data>(dataName, toBigEndian(value)));
+	}
+	table.m_helperFunction = _dispenser.newName("constant_from_data"_yulstring);
+	table(*_object.code);
+	_object.code->statements.emplace_back(table.helperFunction(_dispenser));
+}
+
+void ConstantDataTable::visit(Expression& _e)
+{
+	if (holds_alternative<Literal>(_e))
+	{
+		Literal const& literal = std::get<Literal>(_e);
+		if (literal.kind != LiteralKind::Number)
+			return;
+		u256 value = valueOfLiteral(literal);
+
+		if (m_helperFunction.empty())
+		{
+			if (value >= 0x10000)
+				m_occurrences[value]++;
+		}
+		else if (m_dataNames.count(value))
+		{
+			langutil::SourceLocation location = literal.location;
+			_e = FunctionCall{location, Identifier{location, m_helperFunction}, {
+				FunctionCall{location, Identifier{location, "dataoffset"_yulstring}, {
+					Literal{location, LiteralKind::String, m_dataNames.at(value), {}}
+				}}
+			}};
+		}
+	}
+	else
+		ASTModifier::visit(_e);
+}
+
+FunctionDefinition ConstantDataTable::helperFunction(NameDispenser& _dispenser) const
+{
+	YulString offset = _dispenser.newName("offset"_yulstring);
+	YulString value = _dispenser.newName("value"_yulstring);
+	YulString backup = _dispenser.newName("backup"_yulstring);
+	auto number = [](u256 const& _value) -> Expression {
+		return Literal{{}, LiteralKind::Number, YulString{formatNumber(_value)}, {}};
+	};
+	auto call = [](YulString _function, vector<Expression> _arguments) -> Expression {
+		return FunctionCall{{}, Identifier{{}, _function}, move(_arguments)};
+	};
+
+	// function constant_from_data(offset) -> value {
+	//     let backup := mload(0)
+	//     datacopy(0, offset, 32)
+	//     value := mload(0)
+	//     mstore(0, backup)
+	// }
+	Block body;
+	body.statements.emplace_back(VariableDeclaration{
+		{},
+		{TypedName{{}, backup, {}}},
+		make_unique<Expression>(call("mload"_yulstring, {number(0)}))
+	});
+	body.statements.emplace_back(ExpressionStatement{
+		{},
+		call("datacopy"_yulstring, {number(0), Identifier{{}, offset}, number(32)})
+	});
+	body.statements.emplace_back(Assignment{
+		{},
+		{Identifier{{}, value}},
+		make_unique<Expression>(call("mload"_yulstring, {number(0)}))
+	});
+	body.statements.emplace_back(ExpressionStatement{
+		{},
+		call("mstore"_yulstring, {number(0), Identifier{{}, backup}})
+	});
+	return FunctionDefinition{
+		{},
+		m_helperFunction,
+		{TypedName{{}, offset, {}}},
+		{TypedName{{}, value, {}}},
+		move(body)
+	};
+}
+
 Expression const* RepresentationFinder::tryFindRepresentation(dev::u256 const& _value)
 {
 	if (_value < 0x10000)
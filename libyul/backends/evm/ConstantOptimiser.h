@@ -37,7 +37,9 @@
 namespace yul
 {
 struct Dialect;
+struct Object;
 class GasMeter;
+class NameDispenser;
 
 /**
  * Optimisation stage that replaces constants by expressions that compute them.
@@ -66,6 +68,44 @@ private:
 	std::map<dev::u256, Representation> m_cache;
 };
 
+/**
+ * Optimisation stage that moves large number literals into data entries of the object
+ * and loads them via a single helper function that copies them from the code.
+ *
+ * This is only done if the savings in code size across all moved constants outweigh
+ * the costs of the helper function and the additional runtime costs, as estimated
+ * by the gas meter. The literals that are not moved are left untouched for the
+ * ConstantOptimiser.
+ *
+ * Requires a dialect with object access.
+ *
+ * Prerequisite: Disambiguator
+ */
+class ConstantDataTable: public ASTModifier
+{
+public:
+	static void run(EVMDialect const& _dialect, GasMeter const& _meter, Object& _object, NameDispenser& _dispenser);
+
+	void visit(Expression& _e) override;
+
+private:
+	ConstantDataTable(EVMDialect const& _dialect, GasMeter const& _meter):
+		m_dialect(_dialect),
+		m_meter(_meter)
+	{}
+
+	/// Creates the helper function that copies a constant from the given code offset.
+	FunctionDefinition helperFunction(NameDispenser& _dispenser) const;
+
+	EVMDialect const& m_dialect;
+	GasMeter const& m_meter;
+	/// Number of occurrences of each large literal value, filled in the first pass.
+	std::map<dev::u256, size_t> m_occurrences;
+	/// Name of the data entry for each value to be moved, used in the second pass.
+	std::map<dev::u256, YulString> m_dataNames;
+	YulString m_helperFunction;
+};
+
 class RepresentationFinder
 {
 public:
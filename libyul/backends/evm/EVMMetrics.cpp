@@ -45,6 +45,19 @@ size_t GasMeter::instructionCosts(eth::Instruction _instruction) const
 	return combineCosts(GasMeterVisitor::instructionCosts(_instruction, m_dialect, m_isCreation));
 }
 
+size_t GasMeter::codeCosts(size_t _runGas, size_t _bytes) const
+{
+	size_t byteGas = m_isCreation ?
+		dev::eth::GasCosts::txDataNonZeroGas(m_dialect.evmVersion()) :
+		dev::eth::GasCosts::createDataGas;
+	return combineCosts({_runGas, _bytes * byteGas});
+}
+
+size_t GasMeter::dataCosts(dev::bytes const& _data) const
+{
+	return size_t(dev::eth::GasMeter::dataGas(_data, m_isCreation, m_dialect.evmVersion()));
+}
+
 size_t GasMeter::combineCosts(std::pair<size_t, size_t> _costs) const
 {
 	return _costs.first * m_runs + _costs.second;
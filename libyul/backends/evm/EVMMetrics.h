@@ -23,6 +23,7 @@
 #include <libyul/optimiser/ASTWalker.h>
 #include <liblangutil/EVMVersion.h>
 #include <libevmasm/Instruction.h>
+#include <libdevcore/Common.h>
 
 namespace yul
 {
@@ -50,6 +51,11 @@ public:
 	/// @returns the combined costs of deploying and running the instruction, not including
 	/// the costs for its arguments.
 	size_t instructionCosts(dev::eth::Instruction _instruction) const;
+	/// @returns the combined costs of deploying @a _bytes bytes of code and
+	/// running them, where a single run costs @a _runGas.
+	size_t codeCosts(size_t _runGas, size_t _bytes) const;
+	/// @returns the costs of deploying @a _data as part of the code.
+	size_t dataCosts(dev::bytes const& _data) const;
 
 private:
 	size_t combineCosts(std::pair<size_t, size_t> _costs) const;
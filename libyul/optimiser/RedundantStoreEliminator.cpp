@@ -0,0 +1,135 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Optimisation stage that removes storage writes that are overwritten before they can be observed.
+ */
+
+#include <libyul/optimiser/RedundantStoreEliminator.h>
+
+#include <libyul/backends/evm/EVMDialect.h>
+#include <libyul/optimiser/CallGraphGenerator.h>
+#include <libyul/optimiser/Semantics.h>
+#include <libyul/optimiser/SyntacticalEquality.h>
+#include <libyul/AsmData.h>
+
+#include <libdevcore/CommonData.h>
+
+using namespace std;
+using namespace dev;
+using namespace yul;
+
+void RedundantStoreEliminator::run(OptimiserStepContext& _context, Block& _ast)
+{
+	if (!dynamic_cast<EVMDialect const*>(&_context.dialect))
+		return;
+
+	RedundantStoreEliminator{
+		_context.dialect,
+		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast))
+	}(_ast);
+}
+
+void RedundantStoreEliminator::operator()(Block& _block)
+{
+	ASTModifier::operator()(_block);
+
+	struct PendingWrite
+	{
+		size_t index;
+		Expression const* slot;
+		set<YulString> referencedVariables;
+	};
+	// Writes that were not yet observed by any statement.
+	vector<PendingWrite> pendingWrites;
+	set<size_t> overwritten;
+
+	for (size_t i = 0; i < _block.statements.size(); ++i)
+	{
+		Statement const& statement = _block.statements[i];
+		if (Expression const* slot = storageWriteSlot(statement))
+		{
+			for (auto it = pendingWrites.begin(); it != pendingWrites.end();)
+				if (SyntacticallyEqual{}(*it->slot, *slot))
+				{
+					overwritten.insert(it->index);
+					it = pendingWrites.erase(it);
+				}
+				else
+					++it;
+
+			MovableChecker checker{m_dialect, &m_functionSideEffects};
+			checker.visit(*slot);
+			pendingWrites.push_back({i, slot, checker.referencedVariables()});
+		}
+		else if (auto const* varDecl = get_if<VariableDeclaration>(&statement))
+		{
+			if (!movable(varDecl->value.get()))
+				pendingWrites.clear();
+		}
+		else if (auto const* assignment = get_if<Assignment>(&statement))
+		{
+			if (!movable(assignment->value.get()))
+				pendingWrites.clear();
+			else
+				for (auto const& variable: assignment->variableNames)
+					pendingWrites.erase(
+						remove_if(pendingWrites.begin(), pendingWrites.end(), [&](PendingWrite const& _write) {
+							return _write.referencedVariables.count(variable.name);
+						}),
+						pendingWrites.end()
+					);
+		}
+		else if (auto const* expressionStatement = get_if<ExpressionStatement>(&statement))
+		{
+			if (!movable(&expressionStatement->expression))
+				pendingWrites.clear();
+		}
+		else
+			pendingWrites.clear();
+	}
+
+	if (overwritten.empty())
+		return;
+
+	vector<Statement> statements;
+	for (size_t i = 0; i < _block.statements.size(); ++i)
+		if (!overwritten.count(i))
+			statements.emplace_back(std::move(_block.statements[i]));
+	_block.statements = std::move(statements);
+}
+
+Expression const* RedundantStoreEliminator::storageWriteSlot(Statement const& _statement) const
+{
+	auto const* expressionStatement = get_if<ExpressionStatement>(&_statement);
+	if (!expressionStatement)
+		return nullptr;
+	auto const* funCall = get_if<FunctionCall>(&expressionStatement->expression);
+	if (!funCall)
+		return nullptr;
+	auto const* builtin = dynamic_cast<EVMDialect const&>(m_dialect).builtin(funCall->functionName.name);
+	if (!builtin || builtin->instruction != dev::eth::Instruction::SSTORE)
+		return nullptr;
+	for (auto const& argument: funCall->arguments)
+		if (!movable(&argument))
+			return nullptr;
+	return &funCall->arguments.at(0);
+}
+
+bool RedundantStoreEliminator::movable(Expression const* _expression) const
+{
+	return !_expression || SideEffectsCollector{m_dialect, *_expression, &m_functionSideEffects}.movable();
+}
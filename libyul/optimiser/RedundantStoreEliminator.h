@@ -0,0 +1,84 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Optimisation stage that removes storage writes that are overwritten before they can be observed.
+ */
+
+#pragma once
+
+#include <libyul/optimiser/ASTWalker.h>
+#include <libyul/optimiser/OptimiserStep.h>
+#include <libyul/SideEffects.h>
+#include <libyul/YulString.h>
+
+#include <map>
+
+namespace yul
+{
+
+struct Dialect;
+
+/**
+ * Optimisation stage that removes ``sstore(x, y)`` statements if a later
+ * ``sstore(x, z)`` in the same block writes to the same slot and nothing in between
+ * can read storage or change the control flow.
+ *
+ * Only variable declarations, assignments and expression statements whose values are
+ * movable, as well as further ``sstore`` calls with movable arguments, are allowed
+ * between the two writes. The slot expressions have to be syntactically equal and
+ * none of the variables they reference may be re-assigned in between.
+ *
+ * Together with the LoadResolver, this merges sequences of read-modify-write operations
+ * on the same slot (as generated for packed struct members or array elements) into
+ * a single ``sload`` and a single ``sstore``.
+ *
+ * Works best if the code is in SSA form.
+ *
+ * Prerequisite: Disambiguator.
+ *
+ * Important: Can only be used on EVM code.
+ */
+class RedundantStoreEliminator: public ASTModifier
+{
+public:
+	static constexpr char const* name{"RedundantStoreEliminator"};
+	static void run(OptimiserStepContext&, Block& _ast);
+
+	using ASTModifier::operator();
+	void operator()(Block& _block) override;
+
+private:
+	RedundantStoreEliminator(
+		Dialect const& _dialect,
+		std::map<YulString, SideEffects> _functionSideEffects
+	):
+		m_dialect(_dialect),
+		m_functionSideEffects(std::move(_functionSideEffects))
+	{}
+
+	/// @returns the slot expression if @a _statement is a call to ``sstore``
+	/// with movable arguments and nullptr otherwise.
+	Expression const* storageWriteSlot(Statement const& _statement) const;
+	/// @returns true if evaluating @a _expression (if present) can neither read storage
+	/// nor terminate.
+	bool movable(Expression const* _expression) const;
+
+	Dialect const& m_dialect;
+	std::map<YulString, SideEffects> m_functionSideEffects;
+};
+
+}
@@ -50,6 +50,7 @@
 #include <libyul/optimiser/StructuralSimplifier.h>
 #include <libyul/optimiser/SyntacticalEquality.h>
 #include <libyul/optimiser/RedundantAssignEliminator.h>
+#include <libyul/optimiser/RedundantStoreEliminator.h>
 #include <libyul/optimiser/VarNameCleaner.h>
 #include <libyul/optimiser/LoadResolver.h>
 #include <libyul/optimiser/LoopInvariantCodeMotion.h>
@@ -159,6 +160,7 @@ void OptimiserSuite::run(
 			// simplify again
 			suite.runSequence({
 				LoadResolver::name,
+				RedundantStoreEliminator::name,
 				CommonSubexpressionEliminator::name,
 				UnusedPruner::name,
 			}, ast);
@@ -231,6 +233,7 @@ void OptimiserSuite::run(
 				RedundantAssignEliminator::name,
 				RedundantAssignEliminator::name,
 				LoadResolver::name,
+				RedundantStoreEliminator::name,
 				ExpressionSimplifier::name,
 				LiteralRematerialiser::name,
 				ForLoopConditionOutOfBody::name,
@@ -299,6 +302,8 @@ void OptimiserSuite::run(
 	if (EVMDialect const* dialect = dynamic_cast<EVMDialect const*>(&_dialect))
 	{
 		yulAssert(_meter, "");
+		if (dialect->providesObjectAccess())
+			ConstantDataTable::run(*dialect, *_meter, _object, suite.m_dispenser);
 		ConstantOptimiser{*dialect, *_meter}(ast);
 	}
 	else if (dynamic_cast<WasmDialect const*>(&_dialect))
@@ -361,6 +366,7 @@ map<string, unique_ptr<OptimiserStep>> const& OptimiserSuite::allSteps()
 			LoadResolver,
 			LoopInvariantCodeMotion,
 			RedundantAssignEliminator,
+			RedundantStoreEliminator,
 			Rematerialiser,
 			SSAReverser,
 			SSATransform,
@@ -27,6 +27,7 @@
 
 #include <libsolidity/interface/Version.h>
 #include <libsolidity/parsing/Parser.h>
+#include <libsolidity/ast/ASTBinaryConverter.h>
 #include <libsolidity/ast/ASTJsonConverter.h>
 #include <libsolidity/analysis/NameAndTypeResolver.h>
 #include <libsolidity/interface/CompilerStack.h>
@@ -105,8 +106,11 @@ static string const g_strAsm = "asm";
 static string const g_strAsmJson = "asm-json";
 static string const g_strAssemble = "assemble";
 static string const g_strAst = "ast";
+static string const g_strAstBinary = "ast-binary";
 static string const g_strAstJson = "ast-json";
 static string const g_strAstCompactJson = "ast-compact-json";
+static string const g_strAstSnapshot = "ast-snapshot";
+static string const g_strAstSnapshotOutput = "ast-snapshot-output";
 static string const g_strBinary = "bin";
 static string const g_strBinaryRuntime = "bin-runtime";
 static string const g_strCombinedJson = "combined-json";
@@ -133,6 +137,10 @@ static string const g_strMachine = "machine";
 static string const g_strMetadata = "metadata";
 static string const g_strMetadataHash = "metadata-hash";
 static string const g_strMetadataLiteral = "metadata-literal";
+static string const g_strModelCheckerBMCSummaries = "model-checker-bmc-summaries";
+static string const g_strModelCheckerBMCThreads = "model-checker-bmc-threads";
+static string const g_strModelCheckerCache = "model-checker-cache";
+static string const g_strModelCheckerPortfolio = "model-checker-portfolio";
 static string const g_strNatspecDev = "devdoc";
 static string const g_strNatspecUser = "userdoc";
 static string const g_strNone = "none";
@@ -154,6 +162,14 @@ static set<string> const g_revertStringsArgs
 	revertStringsToString(RevertStrings::VerboseDebug)
 };
 
+/// Possible arguments to for --model-checker-portfolio
+static set<string> const g_modelCheckerPortfolioArgs
+{
+	portfolioModeToString(SMTPortfolioMode::Sequential),
+	portfolioModeToString(SMTPortfolioMode::Race),
+	portfolioModeToString(SMTPortfolioMode::CrossCheck)
+};
+
 static string const g_strSignatureHashes = "hashes";
 static string const g_strSources = "sources";
 static string const g_strSourceList = "sourceList";
@@ -175,8 +191,11 @@ static string const g_argAllowPaths = g_strAllowPaths;
 static string const g_argAsm = g_strAsm;
 static string const g_argAsmJson = g_strAsmJson;
 static string const g_argAssemble = g_strAssemble;
+static string const g_argAstBinary = g_strAstBinary;
 static string const g_argAstCompactJson = g_strAstCompactJson;
 static string const g_argAstJson = g_strAstJson;
+static string const g_argAstSnapshot = g_strAstSnapshot;
+static string const g_argAstSnapshotOutput = g_strAstSnapshotOutput;
 static string const g_argBinary = g_strBinary;
 static string const g_argBinaryRuntime = g_strBinaryRuntime;
 static string const g_argCombinedJson = g_strCombinedJson;
@@ -623,7 +642,7 @@ bool CommandLineInterface::parseLibraryOption(string const& _input)
 	return true;
 }
 
-void CommandLineInterface::createFile(string const& _fileName, string const& _data)
+void CommandLineInterface::createFile(string const& _fileName, string const& _data, bool _binary)
 {
 	namespace fs = boost::filesystem;
 	// create directory if not existent
@@ -638,7 +657,7 @@ void CommandLineInterface::createFile(string const& _fileName, string const& _da
 		m_error = true;
 		return;
 	}
-	ofstream outFile(pathName);
+	ofstream outFile(pathName, _binary ? ios::out | ios::binary : ios::out);
 	outFile << _data;
 	if (!outFile)
 		BOOST_THROW_EXCEPTION(FileError() << errinfo_comment("Could not write to file: " + pathName));
@@ -705,6 +724,29 @@ Allowed options)",
 			po::value<string>()->value_name(boost::join(g_revertStringsArgs, ",")),
 			"Strip revert (and require) reason strings or add additional debugging information."
 		)
+		(
+			g_strModelCheckerPortfolio.c_str(),
+			po::value<string>()->value_name(boost::join(g_modelCheckerPortfolioArgs, ",")),
+			"Query the SMT solvers of the SMTChecker one after the other (default), concurrently using the "
+			"first answer, or concurrently waiting for two answers that agree."
+		)
+		(
+			g_strModelCheckerBMCThreads.c_str(),
+			po::value<unsigned>()->value_name("n")->default_value(1),
+			"Check the verification targets of a function in the bounded model checker on n threads, "
+			"each with SMT solvers of its own. 0 uses one thread per hardware thread."
+		)
+		(
+			g_strModelCheckerBMCSummaries.c_str(),
+			"Encode each internally called function once per contract in the bounded model checker "
+			"and reuse the encoding at all its call sites instead of inlining the function at each call."
+		)
+		(
+			g_strModelCheckerCache.c_str(),
+			po::value<string>()->value_name("path"),
+			"Keep the answers of the SMT solvers of the SMTChecker in the given directory and reuse them "
+			"for the same queries in later compilations."
+		)
 		(
 			(g_argOutputDir + ",o").c_str(),
 			po::value<string>()->value_name("path"),
@@ -764,11 +806,22 @@ Allowed options)",
 		(g_argNoColor.c_str(), "Explicitly disable colored output, disabling terminal auto-detection.")
 		(g_argOldReporter.c_str(), "Enables old diagnostics reporter.")
 		(g_argErrorRecovery.c_str(), "Enables additional parser error recovery.")
+		(
+			g_argAstSnapshot.c_str(),
+			po::value<string>()->value_name("file"),
+			"Load the ASTs of unchanged sources from a snapshot written by --ast-snapshot-output instead of parsing them."
+		)
+		(
+			g_argAstSnapshotOutput.c_str(),
+			po::value<string>()->value_name("file"),
+			"Write a snapshot of the ASTs of all sources that were parsed without errors or warnings."
+		)
 		(g_argIgnoreMissingFiles.c_str(), "Ignore missing files.");
 	po::options_description outputComponents("Output Components");
 	outputComponents.add_options()
 		(g_argAstJson.c_str(), "AST of all source files in JSON format.")
 		(g_argAstCompactJson.c_str(), "AST of all source files in a compact JSON format.")
+		(g_argAstBinary.c_str(), "AST of all source files in a compact binary format, printed in hex or written to binary files.")
 		(g_argAsm.c_str(), "EVM assembly of the contracts.")
 		(g_argAsmJson.c_str(), "EVM assembly of the contracts in JSON format.")
 		(g_argOpcodes.c_str(), "Opcodes of the contracts.")
@@ -847,6 +900,22 @@ Allowed options)",
 		m_revertStrings = *revertStrings;
 	}
 
+	if (m_args.count(g_strModelCheckerPortfolio))
+	{
+		string portfolioString = m_args[g_strModelCheckerPortfolio].as<string>();
+		std::optional<SMTPortfolioMode> portfolioMode = portfolioModeFromString(portfolioString);
+		if (!portfolioMode)
+		{
+			serr() << "Invalid option for --" << g_strModelCheckerPortfolio << ": " << portfolioString << endl;
+			return false;
+		}
+		m_modelCheckerSettings.portfolioMode = *portfolioMode;
+	}
+	m_modelCheckerSettings.bmcThreads = m_args[g_strModelCheckerBMCThreads].as<unsigned>();
+	m_modelCheckerSettings.bmcSummaries = m_args.count(g_strModelCheckerBMCSummaries);
+	if (m_args.count(g_strModelCheckerCache))
+		m_modelCheckerSettings.cacheDirectory = m_args[g_strModelCheckerCache].as<string>();
+
 	if (m_args.count(g_argCombinedJson))
 	{
 		vector<string> requests;
@@ -931,7 +1000,8 @@ bool CommandLineInterface::processInput()
 	{
 		string input = dev::readStandardInput();
 		StandardCompiler compiler(fileReader);
-		sout() << compiler.compile(std::move(input)) << endl;
+		compiler.compile(input, sout());
+		sout() << endl;
 		return true;
 	}
 
@@ -1066,11 +1136,14 @@ bool CommandLineInterface::processInput()
 		if (m_args.count(g_argInputFile))
 			m_compiler->setRemappings(m_remappings);
 		m_compiler->setSources(m_sourceCodes);
+		if (m_args.count(g_argAstSnapshot))
+			m_compiler->setASTSnapshot(asBytes(readFileAsString(m_args[g_argAstSnapshot].as<string>())));
 		if (m_args.count(g_argLibraries))
 			m_compiler->setLibraries(m_libraries);
 		m_compiler->setParserErrorRecovery(m_args.count(g_argErrorRecovery));
 		m_compiler->setEVMVersion(m_evmVersion);
 		m_compiler->setRevertStringBehaviour(m_revertStrings);
+		m_compiler->setModelCheckerSettings(m_modelCheckerSettings);
 		// TODO: Perhaps we should not compile unless requested
 
 		m_compiler->enableIRGeneration(m_args.count(g_argIR));
@@ -1084,6 +1157,19 @@ bool CommandLineInterface::processInput()
 
 		bool successful = m_compiler->compile();
 
+		if (m_args.count(g_argAstSnapshotOutput) && m_compiler->state() >= CompilerStack::ParsingPerformed)
+		{
+			string fileName = m_args[g_argAstSnapshotOutput].as<string>();
+			ofstream outFile(fileName, ofstream::binary);
+			bytes snapshot = m_compiler->astSnapshot();
+			outFile.write(reinterpret_cast<char const*>(snapshot.data()), streamsize(snapshot.size()));
+			if (!outFile)
+			{
+				serr() << "Could not write to file: " << fileName << endl;
+				return false;
+			}
+		}
+
 		for (auto const& error: m_compiler->errors())
 		{
 			g_hasOutput = true;
@@ -1158,18 +1244,25 @@ void CommandLineInterface::handleCombinedJSON()
 	if (!m_args.count(g_argCombinedJson))
 		return;
 
-	Json::Value output(Json::objectValue);
-
-	output[g_strVersion] = ::dev::solidity::VersionString;
 	set<string> requests;
 	boost::split(requests, m_args[g_argCombinedJson].as<string>(), boost::is_any_of(","));
 	vector<string> contracts = m_compiler->contractNames();
 
+	// The output is written while it is being produced, so that at most the AST of a single
+	// source is kept in memory. Members have to be written in the order of their names.
+	stringstream fileData;
+	ostream& out = m_args.count(g_argOutputDir) ? fileData : sout();
+	JsonStreamWriter writer(out, m_args.count(g_argPrettyJson));
+	writer.beginObject();
+
 	if (!contracts.empty())
-		output[g_strContracts] = Json::Value(Json::objectValue);
+	{
+		writer.key(g_strContracts);
+		writer.beginObject();
+	}
 	for (string const& contractName: contracts)
 	{
-		Json::Value& contractData = output[g_strContracts][contractName] = Json::objectValue;
+		Json::Value contractData(Json::objectValue);
 		if (requests.count(g_strAbi))
 			contractData[g_strAbi] = dev::jsonCompactPrint(m_compiler->contractABI(contractName));
 		if (requests.count("metadata"))
@@ -1198,36 +1291,45 @@ void CommandLineInterface::handleCombinedJSON()
 			contractData[g_strNatspecDev] = dev::jsonCompactPrint(m_compiler->natspecDev(contractName));
 		if (requests.count(g_strNatspecUser))
 			contractData[g_strNatspecUser] = dev::jsonCompactPrint(m_compiler->natspecUser(contractName));
+		writer.member(contractName, contractData);
 	}
+	if (!contracts.empty())
+		writer.endObject();
 
 	bool needsSourceList = requests.count(g_strAst) || requests.count(g_strSrcMap) || requests.count(g_strSrcMapRuntime);
 	if (needsSourceList)
 	{
 		// Indices into this array are used to abbreviate source names in source locations.
-		output[g_strSourceList] = Json::Value(Json::arrayValue);
-
+		writer.key(g_strSourceList);
+		writer.beginArray();
 		for (auto const& source: m_compiler->sourceNames())
-			output[g_strSourceList].append(source);
+			writer.value(source);
+		writer.endArray();
 	}
 
 	if (requests.count(g_strAst))
 	{
 		bool legacyFormat = !requests.count(g_strCompactJSON);
-		output[g_strSources] = Json::Value(Json::objectValue);
+		writer.key(g_strSources);
+		writer.beginObject();
 		for (auto const& sourceCode: m_sourceCodes)
 		{
 			ASTJsonConverter converter(legacyFormat, m_compiler->sourceIndices());
-			output[g_strSources][sourceCode.first] = Json::Value(Json::objectValue);
-			output[g_strSources][sourceCode.first]["AST"] = converter.toJson(m_compiler->ast(sourceCode.first));
+			writer.key(sourceCode.first);
+			writer.beginObject();
+			writer.member("AST", converter.toJson(m_compiler->ast(sourceCode.first)));
+			writer.endObject();
 		}
+		writer.endObject();
 	}
 
-	string json = m_args.count(g_argPrettyJson) ? dev::jsonPrettyPrint(output) : dev::jsonCompactPrint(output);
+	writer.member(g_strVersion, ::dev::solidity::VersionString);
+	writer.endObject();
 
 	if (m_args.count(g_argOutputDir))
-		createJson("combined", json);
+		createJson("combined", fileData.str());
 	else
-		sout() << json << endl;
+		sout() << endl;
 }
 
 void CommandLineInterface::handleAst(string const& _argStr)
@@ -1285,6 +1387,30 @@ void CommandLineInterface::handleAst(string const& _argStr)
 	}
 }
 
+void CommandLineInterface::handleBinaryAst()
+{
+	if (!m_args.count(g_argAstBinary))
+		return;
+
+	ASTBinaryConverter converter(m_compiler->sourceIndices());
+	if (m_args.count(g_argOutputDir))
+		for (auto const& sourceCode: m_sourceCodes)
+			createFile(
+				boost::filesystem::path(sourceCode.first).filename().string() + "_binary.ast",
+				asString(converter.toBinary(m_compiler->ast(sourceCode.first))),
+				true
+			);
+	else
+	{
+		sout() << "Binary AST:" << endl << endl;
+		for (auto const& sourceCode: m_sourceCodes)
+		{
+			sout() << endl << "======= " << sourceCode.first << " =======" << endl;
+			sout() << toHex(converter.toBinary(m_compiler->ast(sourceCode.first))) << endl;
+		}
+	}
+}
+
 bool CommandLineInterface::actOnInput()
 {
 	if (m_args.count(g_argStandardJSON) || m_onlyAssemble)
@@ -1517,6 +1643,7 @@ void CommandLineInterface::outputCompilationResults()
 	// do we need AST output?
 	handleAst(g_argAstJson);
 	handleAst(g_argAstCompactJson);
+	handleBinaryAst();
 
 	if (!m_compiler->compilationSuccessful())
 	{
@@ -64,6 +64,7 @@ private:
 
 	void handleCombinedJSON();
 	void handleAst(std::string const& _argStr);
+	void handleBinaryAst();
 	void handleBinary(std::string const& _contract);
 	void handleOpcode(std::string const& _contract);
 	void handleIR(std::string const& _contract);
@@ -85,7 +86,8 @@ private:
 	/// Create a file in the given directory
 	/// @arg _fileName the name of the file
 	/// @arg _data to be written
-	void createFile(std::string const& _fileName, std::string const& _data);
+	/// @arg _binary whether to write the data unchanged, without converting line endings
+	void createFile(std::string const& _fileName, std::string const& _data, bool _binary = false);
 
 	/// Create a json file in the given directory
 	/// @arg _fileName the name of the file (the extension will be replaced with .json)
@@ -114,6 +116,8 @@ private:
 	langutil::EVMVersion m_evmVersion;
 	/// How to handle revert strings
 	RevertStrings m_revertStrings = RevertStrings::Default;
+	/// Settings of the SMTChecker
+	ModelCheckerSettings m_modelCheckerSettings;
 	/// Chosen hash method for the bytecode metadata.
 	CompilerStack::MetadataHash m_metadataHash = CompilerStack::MetadataHash::IPFS;
 	/// Whether or not to colorize diagnostics output.
@@ -23,6 +23,8 @@
 
 #include <test/Options.h>
 
+#include <sstream>
+
 using namespace std;
 
 namespace dev
@@ -30,6 +32,28 @@ namespace dev
 namespace test
 {
 
+namespace
+{
+
+/// @returns the serialisation of @a _input by the jsoncpp stream writer with the settings
+/// used by the compiler before the introduction of JsonStreamWriter.
+string jsoncppPrint(Json::Value const& _input, bool _pretty)
+{
+	Json::StreamWriterBuilder builder;
+	builder["indentation"] = _pretty ? "  " : "";
+	if (_pretty)
+		builder["enableYAMLCompatibility"] = true;
+	ostringstream stream;
+	unique_ptr<Json::StreamWriter>(builder.newStreamWriter())->write(_input, &stream);
+	string result = stream.str();
+	if (_pretty)
+		for (size_t pos = result.find(" \n"); pos != string::npos; pos = result.find(" \n", pos))
+			result.erase(pos, 1);
+	return result;
+}
+
+}
+
 BOOST_AUTO_TEST_SUITE(JsonTest)
 
 BOOST_AUTO_TEST_CASE(json_pretty_print)
@@ -104,6 +128,84 @@ BOOST_AUTO_TEST_CASE(parse_json_strict)
 	BOOST_CHECK(json[0] == "\x80\xec\x80");
 }
 
+BOOST_AUTO_TEST_CASE(json_print_matches_jsoncpp)
+{
+	string allBytes;
+	for (unsigned i = 0; i < 256; ++i)
+		allBytes += static_cast<char>(i);
+
+	Json::Value json(Json::objectValue);
+	json["bytes"] = Json::Value(allBytes.data(), allBytes.data() + allBytes.size());
+	json["utf8"] = "\xc3\xa4\xe2\x82\xac\xf0\x9f\x98\x80\xed\xa0\x80\xc0\x80\xf8";
+	json["truncated"] = "\xe2\x82";
+	json["invalid"] = "\xf7\xbf\xbf\xbf\xf4\x90\x80\x80\xf4\x8f\xbf\xbf\x80\xbf";
+	json["numbers"].append(-1);
+	json["numbers"].append(Json::UInt64(-1));
+	json["numbers"].append(0.5);
+	json["numbers"].append(1e100);
+	json["scalars"].append(Json::Value());
+	json["scalars"].append(true);
+	json["scalars"].append("");
+	json["empty"]["object"] = Json::objectValue;
+	json["empty"]["array"] = Json::arrayValue;
+	json["empty"]["nested"].append(Json::objectValue);
+	json["empty"]["nested"].append(Json::arrayValue);
+	json["nested"].append(json["empty"]);
+	json["nested"].append(Json::arrayValue);
+	json["nested"][1].append(json["numbers"]);
+	json["Upper"] = 1;
+	json["a"] = 2;
+
+	for (Json::Value const& value: {json, json["numbers"], json["bytes"], Json::Value(), Json::Value(Json::objectValue)})
+	{
+		BOOST_CHECK_EQUAL(jsonPrettyPrint(value), jsoncppPrint(value, true));
+		BOOST_CHECK_EQUAL(jsonCompactPrint(value), jsoncppPrint(value, false));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(json_stream_writer)
+{
+	Json::Value json(Json::objectValue);
+	json["a"] = Json::objectValue;
+	json["b"]["c"].append(1);
+	json["b"]["d"] = "x";
+
+	for (bool pretty: {false, true})
+	{
+		ostringstream stream;
+		JsonStreamWriter writer(stream, pretty);
+		writer.beginObject();
+		writer.key("a");
+		writer.beginObject();
+		writer.endObject();
+		writer.key("b");
+		writer.beginObject();
+		writer.member("c", json["b"]["c"]);
+		writer.key("d");
+		writer.value("x");
+		writer.endObject();
+		BOOST_CHECK(!writer.done());
+		writer.endObject();
+		BOOST_CHECK(writer.done());
+		BOOST_CHECK_EQUAL(stream.str(), pretty ? jsonPrettyPrint(json) : jsonCompactPrint(json));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(json_stream_writer_errors)
+{
+	ostringstream stream;
+	JsonStreamWriter writer(stream, false);
+	writer.beginObject();
+	BOOST_CHECK_THROW(writer.value(1), JsonWriterError);
+	writer.key("b");
+	BOOST_CHECK_THROW(writer.key("c"), JsonWriterError);
+	writer.value(1);
+	BOOST_CHECK_THROW(writer.key("a"), JsonWriterError);
+	BOOST_CHECK_THROW(writer.endArray(), JsonWriterError);
+	writer.endObject();
+	BOOST_CHECK_THROW(writer.value(1), JsonWriterError);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
@@ -0,0 +1,68 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Unit tests for the parallelFor function
+ */
+
+#include <libdevcore/Parallel.h>
+
+#include <test/Options.h>
+
+#include <stdexcept>
+
+using namespace std;
+
+namespace dev
+{
+namespace test
+{
+
+BOOST_AUTO_TEST_SUITE(Parallel)
+
+BOOST_AUTO_TEST_CASE(no_tasks)
+{
+	bool called = false;
+	parallelFor(0, [&](size_t) { called = true; });
+	BOOST_CHECK(!called);
+}
+
+BOOST_AUTO_TEST_CASE(every_task_once)
+{
+	vector<size_t> calls(1000, 0);
+	parallelFor(calls.size(), [&](size_t _i) { calls[_i]++; });
+	BOOST_CHECK(calls == vector<size_t>(1000, 1));
+}
+
+BOOST_AUTO_TEST_CASE(first_exception)
+{
+	vector<size_t> calls(100, 0);
+	BOOST_CHECK_EXCEPTION(
+		parallelFor(calls.size(), [&](size_t _i) {
+			calls[_i]++;
+			if (_i % 10 == 3)
+				throw runtime_error(to_string(_i));
+		}),
+		runtime_error,
+		[](runtime_error const& _error) { return string(_error.what()) == "3"; }
+	);
+	BOOST_CHECK(calls == vector<size_t>(100, 1));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
+}
@@ -0,0 +1,191 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Unit tests for the binary AST format.
+ */
+
+#include <test/Options.h>
+
+#include <libsolidity/ast/ASTBinaryConverter.h>
+#include <libsolidity/ast/ASTJsonConverter.h>
+#include <libsolidity/interface/CompilerStack.h>
+
+#include <libdevcore/CommonIO.h>
+#include <libdevcore/JSON.h>
+
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+
+using namespace std;
+
+namespace dev
+{
+namespace solidity
+{
+namespace test
+{
+
+namespace
+{
+
+/// Parses and analyses @a _sources and @returns the JSON and binary ASTs of all sources.
+map<string, pair<Json::Value, bytes>> asts(StringMap const& _sources)
+{
+	CompilerStack compiler;
+	compiler.setSources(_sources);
+	compiler.setEVMVersion(dev::test::Options::get().evmVersion());
+	BOOST_REQUIRE(compiler.parse());
+	compiler.analyze();
+	map<string, pair<Json::Value, bytes>> result;
+	for (string const& sourceName: compiler.sourceNames())
+		result[sourceName] = {
+			ASTJsonConverter(false, compiler.sourceIndices()).toJson(compiler.ast(sourceName)),
+			ASTBinaryConverter(compiler.sourceIndices()).toBinary(compiler.ast(sourceName))
+		};
+	return result;
+}
+
+/// Collects all nodes of the JSON AST @a _ast by their ID.
+void collectNodes(Json::Value const& _ast, map<int64_t, Json::Value const*>& _nodes)
+{
+	if (_ast.isObject() && _ast["id"].isInt64() && _ast["nodeType"].isString())
+		_nodes[_ast["id"].asInt64()] = &_ast;
+	if (_ast.isObject() || _ast.isArray())
+		for (Json::Value const& child: _ast)
+			collectNodes(child, _nodes);
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(ASTBinaryConverterTest)
+
+BOOST_AUTO_TEST_CASE(ast_json_tests)
+{
+	string const sourceDelimiter("// ---- SOURCE: ");
+	boost::filesystem::path testPath = dev::test::Options::get().testPath / "libsolidity" / "ASTJSON";
+	for (auto const& entry: boost::filesystem::recursive_directory_iterator(testPath))
+	{
+		if (entry.path().extension() != ".sol")
+			continue;
+		BOOST_TEST_MESSAGE(entry.path().string());
+		StringMap sources;
+		string sourceName = "a";
+		istringstream stream(readFileAsString(entry.path().string()));
+		for (string line; getline(stream, line);)
+			if (boost::algorithm::starts_with(line, sourceDelimiter))
+				sourceName = line.substr(sourceDelimiter.size());
+			else
+				sources[sourceName] += line + "\n";
+
+		for (auto const& [name, ast]: asts(sources))
+		{
+			auto const& [json, binary] = ast;
+			ASTBinaryReader reader(&binary);
+			BOOST_CHECK_EQUAL(jsonCompactPrint(reader.root().toJson()), jsonCompactPrint(json));
+
+			map<int64_t, Json::Value const*> nodes;
+			collectNodes(json, nodes);
+			vector<int64_t> ids;
+			for (auto const& node: nodes)
+				ids.push_back(node.first);
+			BOOST_CHECK(reader.nodeIDs() == ids);
+			for (auto const& [id, node]: nodes)
+			{
+				BOOST_REQUIRE(reader.node(id));
+				BOOST_CHECK_EQUAL(jsonCompactPrint(reader.node(id)->toJson()), jsonCompactPrint(*node));
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(access)
+{
+	bytes binary = asts({{"a", "contract C { uint x; }"}}).at("a").second;
+	ASTBinaryReader reader(&binary);
+	ASTBinaryValue root = reader.root();
+	BOOST_CHECK(root.kind() == ASTBinaryValue::Kind::Object);
+	BOOST_CHECK_EQUAL(root.member("nodeType")->asString(), "SourceUnit");
+	BOOST_CHECK(!root.member("name"));
+
+	ASTBinaryValue::SourceLocation location = root.member("src")->asSourceLocation();
+	BOOST_CHECK_EQUAL(location.start, 0);
+	BOOST_CHECK_EQUAL(location.length, 22);
+	BOOST_CHECK_EQUAL(location.sourceIndex, 0);
+
+	vector<ASTBinaryValue> nodes = root.member("nodes")->elements();
+	BOOST_REQUIRE_EQUAL(nodes.size(), 1u);
+	BOOST_CHECK_EQUAL(nodes[0].member("name")->asString(), "C");
+	BOOST_CHECK_EQUAL(nodes[0].member("abstract")->asBool(), false);
+	int64_t variableID = nodes[0].member("nodes")->elements().at(0).member("id")->asInt();
+	BOOST_CHECK_EQUAL(reader.node(variableID)->member("name")->asString(), "x");
+	BOOST_CHECK(!reader.node(variableID + 100));
+
+	size_t memberCount = 0;
+	for (auto const& [name, value]: root.members())
+	{
+		BOOST_CHECK_EQUAL(
+			jsonCompactPrint(value.toJson()),
+			jsonCompactPrint(root.member(*name)->toJson())
+		);
+		memberCount++;
+	}
+	BOOST_CHECK_EQUAL(memberCount, root.size());
+}
+
+BOOST_AUTO_TEST_CASE(source_locations)
+{
+	Json::Value ast(Json::objectValue);
+	ast["src"] = "1:-1:" + to_string(size_t(-1));
+	Json::Value node(Json::objectValue);
+	node["src"] = "01:2:3";
+	ast["nodes"].append(node);
+	node["src"] = "1:2";
+	ast["nodes"].append(node);
+	bytes binary = ASTBinaryConverter::fromJson(ast);
+	ASTBinaryReader reader(&binary);
+	BOOST_CHECK(reader.root().member("src")->kind() == ASTBinaryValue::Kind::SourceLocation);
+	BOOST_CHECK_EQUAL(reader.root().member("src")->asSourceLocation().sourceIndex, -1);
+	// Source locations that would be written differently are kept as strings.
+	for (ASTBinaryValue const& element: reader.root().member("nodes")->elements())
+		BOOST_CHECK(element.member("src")->kind() == ASTBinaryValue::Kind::String);
+	BOOST_CHECK_EQUAL(jsonCompactPrint(reader.root().toJson()), jsonCompactPrint(ast));
+}
+
+BOOST_AUTO_TEST_CASE(invalid_data)
+{
+	bytes binary = asts({{"a", "contract C { uint x; }"}}).at("a").second;
+
+	bytes truncated(binary.begin(), binary.end() - 1);
+	BOOST_CHECK_THROW(ASTBinaryReader{&truncated}, InvalidBinaryData);
+
+	bytes wrongMagic = binary;
+	wrongMagic[0] ^= 0xff;
+	BOOST_CHECK_THROW(ASTBinaryReader{&wrongMagic}, InvalidBinaryData);
+
+	bytes wrongVersion = binary;
+	wrongVersion[string("solbinast").size()]++;
+	BOOST_CHECK_THROW(ASTBinaryReader{&wrongVersion}, InvalidBinaryData);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
+}
+}
@@ -0,0 +1,152 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Unit tests for the AST snapshots.
+ */
+
+#include <test/Options.h>
+
+#include <libsolidity/ast/AST.h>
+#include <libsolidity/ast/ASTArena.h>
+#include <libsolidity/ast/ASTJsonConverter.h>
+#include <libsolidity/ast/ASTSnapshot.h>
+#include <libsolidity/interface/CompilerStack.h>
+
+#include <liblangutil/Scanner.h>
+
+#include <libdevcore/CommonIO.h>
+#include <libdevcore/JSON.h>
+#include <libdevcore/Keccak256.h>
+
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+
+using namespace std;
+using namespace langutil;
+
+namespace dev
+{
+namespace solidity
+{
+namespace test
+{
+
+namespace
+{
+
+/// Parses and analyses @a _sources, optionally loading the ASTs from @a _snapshot, like the
+/// AST JSON tests do, which do not require the analysis to succeed.
+/// @returns the AST JSON of all sources and a new snapshot.
+pair<string, bytes> analyze(StringMap const& _sources, bytes const& _snapshot = bytes())
+{
+	CompilerStack compiler;
+	compiler.setSources(_sources);
+	compiler.setEVMVersion(dev::test::Options::get().evmVersion());
+	compiler.setASTSnapshot(_snapshot);
+	BOOST_REQUIRE(compiler.parse());
+	compiler.analyze();
+	string json;
+	for (string const& sourceName: compiler.sourceNames())
+		json += jsonCompactPrint(
+			ASTJsonConverter(false, compiler.sourceIndices()).toJson(compiler.ast(sourceName))
+		);
+	return {json, compiler.astSnapshot()};
+}
+
+/// Splits the contents of an AST JSON test into its sources.
+StringMap testSources(string const& _contents)
+{
+	string const sourceDelimiter("// ---- SOURCE: ");
+	StringMap sources;
+	string sourceName = "a";
+	istringstream stream(_contents);
+	for (string line; getline(stream, line);)
+		if (boost::algorithm::starts_with(line, sourceDelimiter))
+			sourceName = line.substr(sourceDelimiter.size());
+		else
+			sources[sourceName] += line + "\n";
+	return sources;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(ASTSnapshot)
+
+BOOST_AUTO_TEST_CASE(ast_json_tests)
+{
+	boost::filesystem::path testPath = dev::test::Options::get().testPath / "libsolidity" / "ASTJSON";
+	for (auto const& entry: boost::filesystem::recursive_directory_iterator(testPath))
+	{
+		if (entry.path().extension() != ".sol")
+			continue;
+		BOOST_TEST_MESSAGE(entry.path().string());
+		StringMap sources = testSources(readFileAsString(entry.path().string()));
+		auto [expectation, snapshot] = analyze(sources);
+
+		ASTSnapshotReader reader(&snapshot);
+		for (auto const& [name, source]: sources)
+		{
+			BOOST_REQUIRE(reader.contains(name, keccak256(source)));
+			ASTArena arena;
+			auto scanner = make_shared<Scanner>(CharStream(source, name));
+			BOOST_REQUIRE(reader.readAST(name, scanner, 0, arena, dev::test::Options::get().evmVersion()));
+		}
+
+		BOOST_CHECK_EQUAL(analyze(sources, snapshot).first, expectation);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(changed_sources_are_parsed)
+{
+	StringMap sources{
+		{"a", "import \"b\"; contract A is B { function f() public pure override returns (uint) { return 2; } }"},
+		{"b", "contract B { function f() public pure virtual returns (uint) { return 1; } }"}
+	};
+	bytes snapshot = analyze(sources).second;
+
+	sources["b"] = "contract B { uint x; function f() public pure virtual returns (uint) { assembly { } } }";
+	ASTSnapshotReader reader(&snapshot);
+	BOOST_CHECK(reader.contains("a", keccak256(sources["a"])));
+	BOOST_CHECK(!reader.contains("b", keccak256(sources["b"])));
+	string expectation = analyze(sources).first;
+	BOOST_CHECK_EQUAL(analyze(sources, snapshot).first, expectation);
+}
+
+BOOST_AUTO_TEST_CASE(damaged_snapshots_are_ignored)
+{
+	StringMap sources{{"a", "contract C { function f() public { uint x = 1; x++; } }"}};
+	auto [expectation, snapshot] = analyze(sources);
+
+	bytes truncated(snapshot.begin(), snapshot.end() - 1);
+	BOOST_CHECK(!ASTSnapshotReader(&truncated).contains("a", keccak256(sources["a"])));
+	BOOST_CHECK_EQUAL(analyze(sources, truncated).first, expectation);
+
+	// The index is intact, but the AST is not.
+	bytes damaged = snapshot;
+	damaged.back() ^= 0xff;
+	BOOST_CHECK(ASTSnapshotReader(&damaged).contains("a", keccak256(sources["a"])));
+	BOOST_CHECK_EQUAL(analyze(sources, damaged).first, expectation);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
+}
+}
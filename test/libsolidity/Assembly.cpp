@@ -58,12 +58,13 @@ eth::AssemblyItems compileContract(std::shared_ptr<CharStream> _sourceCode)
 	ErrorList errors;
 	ErrorReporter errorReporter(errors);
 	Parser parser(errorReporter, dev::test::Options::get().evmVersion());
+	IDDispenser nodeIDs;
 	ASTPointer<SourceUnit> sourceUnit;
-	BOOST_REQUIRE_NO_THROW(sourceUnit = parser.parse(make_shared<Scanner>(_sourceCode)));
+	BOOST_REQUIRE_NO_THROW(sourceUnit = parser.parse(make_shared<Scanner>(_sourceCode), nodeIDs));
 	BOOST_CHECK(!!sourceUnit);
 
 	map<ASTNode const*, shared_ptr<DeclarationContainer>> scopes;
-	GlobalContext globalContext;
+	GlobalContext globalContext(nodeIDs);
 	NameAndTypeResolver resolver(globalContext, dev::test::Options::get().evmVersion(), scopes, errorReporter);
 	solAssert(Error::containsOnlyWarnings(errorReporter.errors()), "");
 	resolver.registerDeclarations(*sourceUnit);
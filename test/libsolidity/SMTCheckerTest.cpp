@@ -44,12 +44,32 @@ SMTCheckerTest::SMTCheckerTest(string const& _filename, langutil::EVMVersion _ev
 	}
 	else
 		m_enabledSolvers = smt::SMTSolverChoice::All();
+
+	if (m_settings.count("SMTPortfolio"))
+	{
+		auto portfolioMode = portfolioModeFromString(m_settings.at("SMTPortfolio"));
+		if (!portfolioMode)
+			BOOST_THROW_EXCEPTION(runtime_error("Invalid SMT portfolio mode."));
+		m_modelCheckerSettings.portfolioMode = *portfolioMode;
+	}
+
+	if (m_settings.count("BMCThreads"))
+		m_modelCheckerSettings.bmcThreads = stoul(m_settings.at("BMCThreads"));
+
+	if (m_settings.count("BMCSummaries"))
+	{
+		auto const& summaries = m_settings.at("BMCSummaries");
+		if (summaries != "true" && summaries != "false")
+			BOOST_THROW_EXCEPTION(runtime_error("Invalid BMC summaries choice."));
+		m_modelCheckerSettings.bmcSummaries = summaries == "true";
+	}
 }
 
 TestCase::TestResult SMTCheckerTest::run(ostream& _stream, string const& _linePrefix, bool _formatted)
 {
 	setupCompiler();
 	compiler().setSMTSolverChoice(m_enabledSolvers);
+	compiler().setModelCheckerSettings(m_modelCheckerSettings);
 	parseAndAnalyze();
 	filterObtainedErrors();
 
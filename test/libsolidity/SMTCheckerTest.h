@@ -19,6 +19,7 @@
 
 #include <test/libsolidity/SyntaxTest.h>
 
+#include <libsolidity/formal/ModelCheckerSettings.h>
 #include <libsolidity/formal/SolverInterface.h>
 
 #include <string>
@@ -48,6 +49,11 @@ protected:
 	/// The possible options are `all`, `z3`, `cvc4`, `none`,
 	/// where if none is given the default used option is `all`.
 	smt::SMTSolverChoice m_enabledSolvers;
+	/// The portfolio mode is set via option SMTPortfolio in the test.
+	/// The possible options are `sequential` (default), `race` and `crossCheck`.
+	/// The number of BMC threads is set via option BMCThreads.
+	/// Function summaries in BMC are enabled via option BMCSummaries (`true` or `false`).
+	ModelCheckerSettings m_modelCheckerSettings;
 };
 
 }
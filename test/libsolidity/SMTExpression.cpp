@@ -0,0 +1,101 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Unit tests for the sharing of SMT expressions.
+ */
+
+#include <libsolidity/formal/SMTLib2Interface.h>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+
+namespace dev
+{
+namespace solidity
+{
+namespace smt
+{
+namespace test
+{
+
+BOOST_AUTO_TEST_SUITE(SMTExpressionTest)
+
+BOOST_AUTO_TEST_CASE(equal_expressions_share_nodes)
+{
+	map<h256, string> responses;
+	SMTLib2Interface solver(responses, {});
+	Expression x = solver.newVariable("x", make_shared<Sort>(Kind::Int));
+	Expression y = solver.newVariable("y", make_shared<Sort>(Kind::Int));
+
+	Expression a = (x + y) * (x + y) > 2;
+	Expression b = (x + y) * (x + y) > 2;
+	BOOST_CHECK(a.node() == b.node());
+	BOOST_CHECK(a.arguments()[0].arguments()[0].node() == a.arguments()[0].arguments()[1].node());
+	BOOST_CHECK(ExpressionHash{}(a) == ExpressionHash{}(b));
+	BOOST_CHECK(ExpressionIdentity{}(a, b));
+
+	BOOST_CHECK((x + y).node() != (y + x).node());
+	BOOST_CHECK((x + 1).node() != (x + 2).node());
+
+	ExpressionMap<int> map;
+	map[x + y] = 1;
+	map[x + y]++;
+	map[y + x] = 5;
+	BOOST_CHECK_EQUAL(map.size(), 2u);
+	BOOST_CHECK_EQUAL(map.at(x + y), 2);
+}
+
+BOOST_AUTO_TEST_CASE(sorts_are_distinguished)
+{
+	map<h256, string> responses;
+	SMTLib2Interface solver(responses, {});
+	Expression xInt = solver.newVariable("x", make_shared<Sort>(Kind::Int));
+	Expression xBool = solver.newVariable("x", make_shared<Sort>(Kind::Bool));
+	BOOST_CHECK(xInt.node() != xBool.node());
+
+	auto arraySort = make_shared<ArraySort>(make_shared<Sort>(Kind::Int), make_shared<Sort>(Kind::Int));
+	auto otherArraySort = make_shared<ArraySort>(make_shared<Sort>(Kind::Int), make_shared<Sort>(Kind::Bool));
+	Expression a = solver.newVariable("a", arraySort);
+	Expression sameA = solver.newVariable("a", make_shared<ArraySort>(make_shared<Sort>(Kind::Int), make_shared<Sort>(Kind::Int)));
+	Expression otherA = solver.newVariable("a", otherArraySort);
+	BOOST_CHECK(a.node() == sameA.node());
+	BOOST_CHECK(a.node() != otherA.node());
+}
+
+BOOST_AUTO_TEST_CASE(s_expressions)
+{
+	map<h256, string> responses;
+	SMTLib2Interface solver(responses, {});
+	Expression x = solver.newVariable("x", make_shared<Sort>(Kind::Int));
+	Expression y = solver.newVariable("y", make_shared<Sort>(Kind::Int));
+	Expression sum = x + y;
+	Expression e = Expression::ite(sum > 0, sum * sum, 0 - sum);
+	string const expectation = "(ite (> (+ x y) 0) (* (+ x y) (+ x y)) (- 0 (+ x y)))";
+	BOOST_CHECK_EQUAL(solver.toSExpr(e), expectation);
+	// The second translation uses the cached S-expressions.
+	BOOST_CHECK_EQUAL(solver.toSExpr(e), expectation);
+	solver.reset();
+	BOOST_CHECK_EQUAL(solver.toSExpr(e), expectation);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
+}
+}
+}
@@ -0,0 +1,177 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Unit tests for the queries of the SMT-LIB2 interface.
+ */
+
+#include <libsolidity/formal/SMTLib2Interface.h>
+
+#include <libdevcore/Keccak256.h>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+
+namespace dev
+{
+namespace solidity
+{
+namespace smt
+{
+namespace test
+{
+
+namespace
+{
+
+/// Callback that records all queries and answers them with @a _response unless their kind
+/// is @a _failingKind.
+struct RecordingCallback
+{
+	vector<pair<string, string>> queries;
+	string response = "unsat\n";
+	string failingKind;
+
+	ReadCallback::Callback callback()
+	{
+		return [this](string const& _kind, string const& _data) {
+			queries.emplace_back(_kind, _data);
+			if (_kind == failingKind)
+				return ReadCallback::Result{false, "Not supported."};
+			return ReadCallback::Result{true, response};
+		};
+	}
+};
+
+/// @returns the commands of the session query @a _query after its first line.
+string sessionCommands(pair<string, string> const& _query)
+{
+	BOOST_REQUIRE_EQUAL(_query.first, "smt-session");
+	BOOST_REQUIRE(_query.second.substr(0, 10) == "; session ");
+	return _query.second.substr(_query.second.find('\n') + 1);
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(SMTLib2InterfaceTest)
+
+BOOST_AUTO_TEST_CASE(session_sends_differences)
+{
+	map<h256, string> responses;
+	RecordingCallback recorder;
+	recorder.response = "sat\n((|EVALEXPR_0| 1))\n";
+	{
+		SMTLib2Interface solver(responses, recorder.callback(), true);
+		Expression x = solver.newVariable("x", make_shared<Sort>(Kind::Int));
+		solver.addAssertion(x > 0);
+		solver.push();
+		solver.addAssertion(x < 2);
+		auto [result, values] = solver.check({x});
+		BOOST_CHECK(result == CheckResult::SATISFIABLE);
+		BOOST_CHECK(values == vector<string>{"1"});
+		BOOST_REQUIRE_EQUAL(recorder.queries.size(), 1u);
+		BOOST_CHECK_EQUAL(
+			sessionCommands(recorder.queries[0]),
+			"(set-option :produce-models true)\n"
+			"(set-logic ALL)\n"
+			"(declare-fun |x| () Int)\n"
+			"(assert (> x 0))\n"
+			"(push 1)\n"
+			"(assert (< x 2))\n"
+			"(push 1)\n"
+			"(declare-const |EVALEXPR_0| Int)\n"
+			"(assert (= |EVALEXPR_0| x))\n"
+			"(check-sat)\n"
+			"(get-value (|EVALEXPR_0| ))\n"
+			"(pop 1)\n"
+		);
+
+		solver.pop();
+		recorder.response = "unsat\n";
+		BOOST_CHECK(solver.check({}).first == CheckResult::UNSATISFIABLE);
+		BOOST_REQUIRE_EQUAL(recorder.queries.size(), 2u);
+		BOOST_CHECK_EQUAL(sessionCommands(recorder.queries[1]), "(pop 1)\n(push 1)\n(check-sat)\n(pop 1)\n");
+
+		solver.reset();
+		solver.check({});
+		BOOST_REQUIRE_EQUAL(recorder.queries.size(), 3u);
+		BOOST_CHECK_EQUAL(
+			sessionCommands(recorder.queries[2]),
+			"(reset)\n(set-option :produce-models true)\n(set-logic ALL)\n(push 1)\n(check-sat)\n(pop 1)\n"
+		);
+		BOOST_CHECK(solver.unhandledQueries().empty());
+	}
+	BOOST_REQUIRE_EQUAL(recorder.queries.size(), 4u);
+	BOOST_CHECK_EQUAL(sessionCommands(recorder.queries[3]), "(exit)\n");
+	BOOST_CHECK(recorder.queries[0].second.substr(0, recorder.queries[0].second.find('\n')) ==
+		recorder.queries[3].second.substr(0, recorder.queries[3].second.find('\n')));
+}
+
+BOOST_AUTO_TEST_CASE(session_falls_back_to_whole_queries)
+{
+	map<h256, string> responses;
+	RecordingCallback recorder;
+	recorder.failingKind = "smt-session";
+	{
+		SMTLib2Interface solver(responses, recorder.callback(), true);
+		Expression x = solver.newVariable("x", make_shared<Sort>(Kind::Int));
+		solver.addAssertion(x > 0);
+		BOOST_CHECK(solver.check({}).first == CheckResult::UNSATISFIABLE);
+		BOOST_REQUIRE_EQUAL(recorder.queries.size(), 2u);
+		BOOST_CHECK_EQUAL(recorder.queries[0].first, "smt-session");
+		BOOST_CHECK_EQUAL(recorder.queries[1].first, "smt-query");
+		BOOST_CHECK_EQUAL(
+			recorder.queries[1].second,
+			"(set-option :produce-models true)\n"
+			"(set-logic ALL)\n"
+			"(declare-fun |x| () Int)\n"
+			"(assert (> x 0))\n"
+			"(check-sat)\n"
+		);
+
+		// The answer to the same query is reused.
+		BOOST_CHECK(solver.check({}).first == CheckResult::UNSATISFIABLE);
+		BOOST_CHECK_EQUAL(recorder.queries.size(), 2u);
+		solver.addAssertion(x > 1);
+		solver.check({});
+		BOOST_CHECK_EQUAL(recorder.queries.size(), 3u);
+		BOOST_CHECK_EQUAL(recorder.queries[2].first, "smt-query");
+	}
+	// The session was never started, so it is not ended either.
+	BOOST_CHECK_EQUAL(recorder.queries.size(), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(unhandled_queries)
+{
+	map<h256, string> responses;
+	SMTLib2Interface solver(responses, {}, true);
+	Expression x = solver.newVariable("x", make_shared<Sort>(Kind::Int));
+	solver.addAssertion(x > 0);
+	BOOST_CHECK(solver.check({}).first == CheckResult::UNKNOWN);
+	BOOST_REQUIRE_EQUAL(solver.unhandledQueries().size(), 1u);
+	string query = solver.unhandledQueries().front();
+
+	responses[keccak256(query)] = "sat\n";
+	BOOST_CHECK(solver.check({}).first == CheckResult::SATISFIABLE);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
+}
+}
+}
@@ -0,0 +1,156 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Unit tests for the cache of SMT solver answers.
+ */
+
+#include <libsolidity/formal/SMTLib2Interface.h>
+#include <libsolidity/formal/SMTResultCache.h>
+
+#include <libdevcore/Keccak256.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+
+using namespace std;
+
+namespace dev
+{
+namespace solidity
+{
+namespace smt
+{
+namespace test
+{
+
+namespace
+{
+
+/// Temporary directory that is removed at the end of the test.
+struct TemporaryDirectory
+{
+	TemporaryDirectory():
+		path(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("smt-cache-%%%%-%%%%-%%%%"))
+	{}
+	~TemporaryDirectory()
+	{
+		boost::system::error_code error;
+		boost::filesystem::remove_all(path, error);
+	}
+	boost::filesystem::path path;
+};
+
+/// @returns a variable called @a _name.
+Expression variable(string const& _name, SortPointer const& _sort = make_shared<Sort>(Kind::Int))
+{
+	map<h256, string> responses;
+	SMTLib2Interface solver(responses, {});
+	return solver.newVariable(_name, _sort);
+}
+
+/// @returns the key of the query that asserts x = x for a variable x called @a _name.
+h256 queryKey(SMTResultCache& _cache, string const& _name, SortPointer const& _sort = make_shared<Sort>(Kind::Int))
+{
+	_cache.reset();
+	_cache.declareVariable("this", make_shared<Sort>(Kind::Int));
+	_cache.declareVariable(_name, _sort);
+	Expression x = variable(_name, _sort);
+	_cache.add("assert", x == x);
+	return _cache.key("check", {x});
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(SMTResultCacheTest)
+
+BOOST_AUTO_TEST_CASE(keys)
+{
+	TemporaryDirectory directory;
+	SMTResultCache cache(directory.path.string(), "z3");
+	h256 key = queryKey(cache, "x_4_0");
+	// Keys do not depend on the names of the variables.
+	BOOST_CHECK(queryKey(cache, "x_17_0") == key);
+	BOOST_CHECK(queryKey(cache, "x_4_0", make_shared<Sort>(Kind::Bool)) != key);
+	BOOST_CHECK(cache.key("check", {}) != key);
+
+	SMTResultCache otherSolver(directory.path.string(), "cvc4");
+	BOOST_CHECK(queryKey(otherSolver, "x_4_0") != key);
+
+	// Scopes restore the query.
+	queryKey(cache, "x");
+	h256 outer = cache.key("check", {});
+	cache.push();
+	cache.add("assert", variable("x") < 3);
+	BOOST_CHECK(cache.key("check", {}) != outer);
+	cache.pop();
+	BOOST_CHECK(cache.key("check", {}) == outer);
+}
+
+BOOST_AUTO_TEST_CASE(answers)
+{
+	TemporaryDirectory directory;
+	h256 key = keccak256("query");
+	{
+		SMTResultCache cache(directory.path.string(), "z3");
+		BOOST_CHECK(!cache.lookup(key));
+		cache.store(key, {CheckResult::UNKNOWN, {}});
+		cache.store(keccak256("error"), {CheckResult::ERROR, {}});
+		BOOST_CHECK(!cache.lookup(key));
+		cache.store(key, {CheckResult::SATISFIABLE, {"1", "(- 2)"}});
+	}
+
+	// Answers persist across instances.
+	SMTResultCache cache(directory.path.string(), "z3");
+	auto answer = cache.lookup(key);
+	BOOST_REQUIRE(answer);
+	BOOST_CHECK(answer->first == CheckResult::SATISFIABLE);
+	BOOST_CHECK(answer->second == (vector<string>{"1", "(- 2)"}));
+	BOOST_CHECK(!cache.lookup(keccak256("error")));
+
+	// Invalid entries are ignored.
+	ofstream(directory.path / keccak256("invalid").hex()) << "{\"result\": \"maybe\"}";
+	BOOST_CHECK(!cache.lookup(keccak256("invalid")));
+
+	// Only the entries themselves are left in the directory.
+	size_t entries = 0;
+	for (auto const& entry: boost::filesystem::directory_iterator(directory.path))
+	{
+		(void)entry;
+		entries++;
+	}
+	BOOST_CHECK_EQUAL(entries, 2u);
+}
+
+BOOST_AUTO_TEST_CASE(unwritable_directory)
+{
+	TemporaryDirectory directory;
+	ofstream(directory.path.string()) << "not a directory";
+	SMTResultCache cache(directory.path.string(), "z3");
+	h256 key = keccak256("query");
+	cache.store(key, {CheckResult::UNSATISFIABLE, {}});
+	BOOST_CHECK(!cache.lookup(key));
+	boost::filesystem::remove(directory.path);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
+}
+}
+}
@@ -97,13 +97,15 @@ bytes compileFirstExpression(
 	vector<vector<string>> _localVariables = {}
 )
 {
+	IDDispenser nodeIDs;
 	ASTPointer<SourceUnit> sourceUnit;
 	try
 	{
 		ErrorList errors;
 		ErrorReporter errorReporter(errors);
 		sourceUnit = Parser(errorReporter, dev::test::Options::get().evmVersion()).parse(
-			make_shared<Scanner>(CharStream(_sourceCode, ""))
+			make_shared<Scanner>(CharStream(_sourceCode, "")),
+			nodeIDs
 		);
 		if (!sourceUnit)
 			return bytes();
@@ -116,7 +118,7 @@ bytes compileFirstExpression(
 
 	ErrorList errors;
 	ErrorReporter errorReporter(errors);
-	GlobalContext globalContext;
+	GlobalContext globalContext(nodeIDs);
 	map<ASTNode const*, shared_ptr<DeclarationContainer>> scopes;
 	NameAndTypeResolver resolver(globalContext, dev::test::Options::get().evmVersion(), scopes, errorReporter);
 	resolver.registerDeclarations(*sourceUnit);
@@ -676,6 +676,39 @@ BOOST_AUTO_TEST_CASE(optimise_constant_to_codecopy)
 	BOOST_CHECK_EQUAL(numInstructions(m_optimizedBytecode, Instruction::CODECOPY), 4);
 }
 
+BOOST_AUTO_TEST_CASE(optimise_constants_to_shared_codecopy)
+{
+	char const* sourceCode = R"(
+		contract C {
+			function f(uint x) public pure returns (uint r) {
+				r = x ^ 0x8ab4c7d9e01f2a3b4c5d6e7f8091a2b3c4d5e6f708192a3b4c5d6e7f80912a3b;
+				if (x > 1) r += 0x7123456789abcdef0123456789abcdef0123456789abcdef0123456789abcd11;
+				if (x > 2) r ^= 0x6a5b4c3d2e1f0a9b8c7d6e5f4a3b2c1d0e9f8a7b6c5d4e3f2a1b0c9d8e7f6a51;
+				if (x > 3) r += 0x5a5b4c3d2e1f0a9b8c7d6e5f4a3b2c1d0e9f8a7b6c5d4e3f2a1b0c9d8e7f6a52;
+				if (x > 4) r ^= 0x4a5b4c3d2e1f0a9b8c7d6e5f4a3b2c1d0e9f8a7b6c5d4e3f2a1b0c9d8e7f6a53;
+				if (x > 5) r += 0x3a5b4c3d2e1f0a9b8c7d6e5f4a3b2c1d0e9f8a7b6c5d4e3f2a1b0c9d8e7f6a54;
+			}
+			function g(uint x) public pure returns (uint r) {
+				r = x & 0x7123456789abcdef0123456789abcdef0123456789abcdef0123456789abcd11;
+				r ^= 0x6a5b4c3d2e1f0a9b8c7d6e5f4a3b2c1d0e9f8a7b6c5d4e3f2a1b0c9d8e7f6a51;
+				r -= 0x5a5b4c3d2e1f0a9b8c7d6e5f4a3b2c1d0e9f8a7b6c5d4e3f2a1b0c9d8e7f6a52;
+				r |= 0x4a5b4c3d2e1f0a9b8c7d6e5f4a3b2c1d0e9f8a7b6c5d4e3f2a1b0c9d8e7f6a53;
+				r *= 0x3a5b4c3d2e1f0a9b8c7d6e5f4a3b2c1d0e9f8a7b6c5d4e3f2a1b0c9d8e7f6a54;
+				r += 0x8ab4c7d9e01f2a3b4c5d6e7f8091a2b3c4d5e6f708192a3b4c5d6e7f80912a3b;
+			}
+		}
+	)";
+	// With very few runs, all constants are copied from code via a single shared routine.
+	compileBothVersions(sourceCode, 0, "C", 1);
+	for (u256 x = 0; x < 8; ++x)
+	{
+		compareVersions("f(uint256)", x);
+		compareVersions("g(uint256)", x);
+	}
+	BOOST_CHECK_EQUAL(numInstructions(m_nonOptimizedBytecode, Instruction::CODECOPY), 0);
+	BOOST_CHECK_EQUAL(numInstructions(m_optimizedBytecode, Instruction::CODECOPY), 1);
+}
+
 BOOST_AUTO_TEST_CASE(byte_access)
 {
 	char const* sourceCode = R"(
@@ -44,11 +44,12 @@ namespace
 ASTPointer<ContractDefinition> parseText(std::string const& _source, ErrorList& _errors, bool errorRecovery = false)
 {
 	ErrorReporter errorReporter(_errors);
+	IDDispenser nodeIDs;
 	ASTPointer<SourceUnit> sourceUnit = Parser(
 		errorReporter,
 		dev::test::Options::get().evmVersion(),
 		errorRecovery
-	).parse(std::make_shared<Scanner>(CharStream(_source, "")));
+	).parse(std::make_shared<Scanner>(CharStream(_source, "")), nodeIDs);
 	if (!sourceUnit)
 		return ASTPointer<ContractDefinition>();
 	for (ASTPointer<ASTNode> const& node: sourceUnit->nodes())
@@ -21,6 +21,8 @@
 
 #include <string>
 #include <boost/test/unit_test.hpp>
+#include <boost/algorithm/string/replace.hpp>
+#include <libsolidity/ast/ASTBinaryConverter.h>
 #include <libsolidity/interface/StandardCompiler.h>
 #include <libsolidity/interface/Version.h>
 #include <libdevcore/JSON.h>
@@ -433,6 +435,36 @@ BOOST_AUTO_TEST_CASE(basic_compilation)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(binary_ast)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"sources": {
+			"fileA": {
+				"content": "contract A { function f() public {} }"
+			}
+		},
+		"settings": {
+			"outputSelection": {
+				"fileA": {
+					"": [ "ast", "binaryAST" ]
+				}
+			}
+		}
+	}
+	)";
+	Json::Value result = compile(input);
+	BOOST_CHECK(containsAtMostWarnings(result));
+	BOOST_REQUIRE(result["sources"]["fileA"]["binaryAST"].isString());
+	bytes binaryAST = fromHex(result["sources"]["fileA"]["binaryAST"].asString());
+	ASTBinaryReader reader(&binaryAST);
+	BOOST_CHECK_EQUAL(
+		dev::jsonCompactPrint(reader.root().toJson()),
+		dev::jsonCompactPrint(result["sources"]["fileA"]["ast"])
+	);
+}
+
 BOOST_AUTO_TEST_CASE(compilation_error)
 {
 	char const* input = R"(
@@ -714,6 +746,137 @@ BOOST_AUTO_TEST_CASE(library_filename_with_colon)
 	BOOST_CHECK(contract["evm"]["bytecode"]["linkReferences"]["git:library.sol"]["L"][0].isObject());
 }
 
+BOOST_AUTO_TEST_CASE(model_checker_portfolio)
+{
+	string input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"modelChecker": {
+				"portfolio": "PORTFOLIO"
+			}
+		},
+		"sources": {
+			"fileA": {
+				"content": "pragma experimental SMTChecker; contract A { function f(uint x) public pure { assert(x >= 0); } }"
+			}
+		}
+	}
+	)";
+	for (string portfolio: {"sequential", "race", "crossCheck"})
+	{
+		Json::Value result = compile(boost::replace_all_copy(input, "PORTFOLIO", portfolio));
+		BOOST_CHECK(containsAtMostWarnings(result));
+	}
+	Json::Value result = compile(boost::replace_all_copy(input, "PORTFOLIO", "parallel"));
+	BOOST_CHECK(containsError(result, "JSONError", "Invalid value for settings.modelChecker.portfolio."));
+	result = compile(boost::replace_all_copy(input, "\"PORTFOLIO\"", "1"));
+	BOOST_CHECK(containsError(result, "JSONError", "settings.modelChecker.portfolio must be a string."));
+}
+
+BOOST_AUTO_TEST_CASE(model_checker_bmc_threads)
+{
+	string input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"modelChecker": {
+				"bmcThreads": THREADS
+			}
+		},
+		"sources": {
+			"fileA": {
+				"content": "pragma experimental SMTChecker; contract A { function f(uint x, uint y) public pure { assert(x + y >= x); } }"
+			}
+		}
+	}
+	)";
+	for (string threads: {"0", "1", "4"})
+	{
+		Json::Value result = compile(boost::replace_all_copy(input, "THREADS", threads));
+		BOOST_CHECK(containsAtMostWarnings(result));
+	}
+	Json::Value result = compile(boost::replace_all_copy(input, "THREADS", "-1"));
+	BOOST_CHECK(containsError(result, "JSONError", "settings.modelChecker.bmcThreads must be an unsigned number."));
+	result = compile(boost::replace_all_copy(input, "THREADS", "\"2\""));
+	BOOST_CHECK(containsError(result, "JSONError", "settings.modelChecker.bmcThreads must be an unsigned number."));
+}
+
+BOOST_AUTO_TEST_CASE(model_checker_bmc_summaries)
+{
+	string input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"modelChecker": {
+				"bmcSummaries": SUMMARIES
+			}
+		},
+		"sources": {
+			"fileA": {
+				"content": "pragma experimental SMTChecker; contract A { function g(uint x) internal pure returns (uint) { return x + 1; } function f(uint x) public pure { assert(g(x) > x); } }"
+			}
+		}
+	}
+	)";
+	for (string summaries: {"true", "false"})
+	{
+		Json::Value result = compile(boost::replace_all_copy(input, "SUMMARIES", summaries));
+		BOOST_CHECK(containsAtMostWarnings(result));
+	}
+	Json::Value result = compile(boost::replace_all_copy(input, "SUMMARIES", "1"));
+	BOOST_CHECK(containsError(result, "JSONError", "settings.modelChecker.bmcSummaries must be a Boolean."));
+}
+
+BOOST_AUTO_TEST_CASE(model_checker_cache_directory)
+{
+	string input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"modelChecker": {
+				"cacheDirectory": DIRECTORY
+			}
+		},
+		"sources": {
+			"fileA": {
+				"content": "pragma experimental SMTChecker; contract A { function f(uint x, uint y) public pure { assert(x + y >= x); } }"
+			}
+		}
+	}
+	)";
+	Json::Value result = compile(boost::replace_all_copy(input, "DIRECTORY", "\"\""));
+	BOOST_CHECK(containsAtMostWarnings(result));
+	result = compile(boost::replace_all_copy(input, "DIRECTORY", "1"));
+	BOOST_CHECK(containsError(result, "JSONError", "settings.modelChecker.cacheDirectory must be a string."));
+}
+
+BOOST_AUTO_TEST_CASE(model_checker_smtlib2_sessions)
+{
+	string input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"modelChecker": {
+				"smtlib2Sessions": SESSIONS
+			}
+		},
+		"sources": {
+			"fileA": {
+				"content": "pragma experimental SMTChecker; contract A { function f(uint x, uint y) public pure { assert(x + y >= x); } }"
+			}
+		}
+	}
+	)";
+	for (string sessions: {"true", "false"})
+	{
+		Json::Value result = compile(boost::replace_all_copy(input, "SESSIONS", sessions));
+		BOOST_CHECK(containsAtMostWarnings(result));
+	}
+	Json::Value result = compile(boost::replace_all_copy(input, "SESSIONS", "1"));
+	BOOST_CHECK(containsError(result, "JSONError", "settings.modelChecker.smtlib2Sessions must be a Boolean."));
+}
+
 BOOST_AUTO_TEST_CASE(libraries_invalid_top_level)
 {
 	char const* input = R"(
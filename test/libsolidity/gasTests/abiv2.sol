@@ -14,9 +14,9 @@ contract C {
 }
 // ----
 // creation:
-//   codeDepositCost: 1120000
-//   executionCost: 1160
-//   totalCost: 1121160
+//   codeDepositCost: 1132800
+//   executionCost: 1174
+//   totalCost: 1133974
 // external:
 //   a(): 1130
 //   b(uint256): infinite
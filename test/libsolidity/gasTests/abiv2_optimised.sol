@@ -17,9 +17,9 @@ contract C {
 // optimize-yul: true
 // ----
 // creation:
-//   codeDepositCost: 605800
-//   executionCost: 638
-//   totalCost: 606438
+//   codeDepositCost: 618600
+//   executionCost: 651
+//   totalCost: 619251
 // external:
 //   a(): 1029
 //   b(uint256): 2084
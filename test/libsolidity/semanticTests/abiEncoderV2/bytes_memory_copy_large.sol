@@ -0,0 +1,22 @@
+pragma experimental ABIEncoderV2;
+
+contract C {
+    function f(uint256 n) public pure returns (bool) {
+        bytes memory a = new bytes(n);
+        for (uint i = 0; i < n; i++)
+            a[i] = bytes1(uint8(i * 7));
+        bytes memory b = abi.encode(a, uint8(0xff), a);
+        (bytes memory c, uint8 x, bytes memory d) = abi.decode(b, (bytes, uint8, bytes));
+        return
+            b.length == 0xa0 + 2 * ((n + 31) / 32 * 32) &&
+            keccak256(a) == keccak256(c) &&
+            keccak256(a) == keccak256(d) &&
+            x == 0xff;
+    }
+}
+// ----
+// f(uint256): 0 -> true
+// f(uint256): 31 -> true
+// f(uint256): 64 -> true
+// f(uint256): 700 -> true
+// f(uint256): 1025 -> true
@@ -0,0 +1,20 @@
+contract C {
+    function f(uint256 n) public pure returns (bool) {
+        bytes memory a = new bytes(n);
+        for (uint i = 0; i < n; i++)
+            a[i] = bytes1(uint8(i * 7));
+        bytes memory b = abi.encodePacked(a, uint8(0xff), a);
+        if (b.length != 2 * n + 1)
+            return false;
+        for (uint i = 0; i < n; i++)
+            if (b[i] != a[i] || b[n + 1 + i] != a[i])
+                return false;
+        return b[n] == 0xff;
+    }
+}
+// ----
+// f(uint256): 0 -> true
+// f(uint256): 31 -> true
+// f(uint256): 64 -> true
+// f(uint256): 700 -> true
+// f(uint256): 1025 -> true
@@ -0,0 +1,34 @@
+contract C {
+    uint8[] a;
+    int16[] b;
+    bytes3[] c;
+    bool[5] d;
+
+    function f(uint8[] memory x) public returns (uint8[] memory) { a = x; return a; }
+    function g(int16[] calldata x) external returns (int16[] memory) { b = x; return b; }
+    function h(bytes3[] memory x) public returns (bytes3[] memory) { c = x; return c; }
+    function i(bool[5] memory x) public returns (bool[5] memory) { d = x; return d; }
+    function shrink() public returns (uint sum) {
+        uint8[] memory x = new uint8[](40);
+        for (uint j = 0; j < 40; j++)
+            x[j] = 0xff;
+        a = x;
+        x = new uint8[](3);
+        x[0] = 1;
+        x[1] = 2;
+        x[2] = 3;
+        a = x;
+        while (a.length < 40)
+            a.push();
+        for (uint j = 0; j < a.length; j++)
+            sum += a[j];
+    }
+}
+// ----
+// f(uint8[]): 0x20, 0 -> 0x20, 0
+// f(uint8[]): 0x20, 3, 1, 2, 3 -> 0x20, 3, 1, 2, 3
+// f(uint8[]): 0x20, 1, 0x1ff -> 0x20, 1, 0xff
+// g(int16[]): 0x20, 3, -1, 2, -3 -> 0x20, 3, -1, 2, -3
+// h(bytes3[]): 0x20, 2, left(0x616263), left(0x646566) -> 0x20, 2, left(0x616263), left(0x646566)
+// i(bool[5]): 1, 0, 1, 1, 0 -> 1, 0, 1, 1, 0
+// shrink() -> 6
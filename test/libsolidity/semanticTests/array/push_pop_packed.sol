@@ -0,0 +1,23 @@
+contract C {
+    uint8[] a;
+
+    function f() public returns (uint256) {
+        a.push(1);
+        a.push(2);
+        a.push(3);
+        a.pop();
+        a.push();
+        return uint256(a[0]) * 100 + uint256(a[1]) * 10 + a[2] + a.length * 1000;
+    }
+    function g() public returns (uint256) {
+        delete a;
+        a.push();
+        a.push();
+        return uint256(a[0]) + a[1] + a.length;
+    }
+}
+// ====
+// compileViaYul: also
+// ----
+// f() -> 3120
+// g() -> 2
@@ -0,0 +1,15 @@
+pragma experimental SMTChecker;
+
+contract C
+{
+	function f(uint x) public pure {
+		require(x < 100);
+		uint y = x * 2;
+		assert(y < 200);
+		assert(y < 100);
+	}
+}
+// ====
+// SMTPortfolio: crossCheck
+// ----
+// Warning: (139-154): Assertion violation happens here
@@ -0,0 +1,20 @@
+pragma experimental SMTChecker;
+
+contract C
+{
+	function inc(uint x) internal pure returns (uint) {
+		require(x < 100);
+		return x + 1;
+	}
+	function f(uint a, uint b) public pure {
+		uint y = inc(a);
+		uint z = inc(b);
+		assert(y == a + 1);
+		assert(z == b + 1);
+		// Fails for a != b.
+		assert(z == a + 1);
+	}
+}
+// ====
+// BMCSummaries: true
+// ----
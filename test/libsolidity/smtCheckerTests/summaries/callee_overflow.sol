@@ -0,0 +1,21 @@
+pragma experimental SMTChecker;
+
+contract C
+{
+	uint8 x;
+	function add(uint8 y) internal returns (uint8) {
+		x = x + y;
+		return x;
+	}
+	function f() public {
+		x = 200;
+		add(50);
+		// Overflows.
+		add(10);
+	}
+}
+// ====
+// BMCSummaries: true
+// ----
+// Warning: (112-117): Overflow (resulting value larger than 255) happens here
+// Warning: (112-117): Overflow (resulting value larger than 255) happens here
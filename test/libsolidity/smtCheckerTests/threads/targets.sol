@@ -0,0 +1,22 @@
+pragma experimental SMTChecker;
+
+contract C
+{
+	function f(uint8 x, uint8 y, uint8 z) public pure returns (uint8) {
+		require(x < 100);
+		uint8 a = x + 100;
+		uint8 b = x + y;
+		uint8 c = a * 2;
+		uint8 d = b - z;
+		assert(a >= 100);
+		assert(c >= 0);
+		require(z != 0);
+		return d / z;
+	}
+}
+// ====
+// BMCThreads: 3
+// ----
+// Warning: (168-173): Overflow (resulting value larger than 255) happens here
+// Warning: (187-192): Overflow (resulting value larger than 255) happens here
+// Warning: (206-211): Underflow (resulting value less than 0) happens here
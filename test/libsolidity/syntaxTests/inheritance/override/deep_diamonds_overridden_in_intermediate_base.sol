@@ -0,0 +1,77 @@
+contract A0 { function f() public virtual {} }
+contract B1 is A0 { function f() public virtual override {} }
+contract C1 is A0 { function f() public virtual override {} }
+contract A1 is B1, C1 { function f() public virtual override(B1, C1) {} }
+contract B2 is A1 { function f() public virtual override {} }
+contract C2 is A1 { function f() public virtual override {} }
+contract A2 is B2, C2 { function f() public virtual override(B2, C2) {} }
+contract B3 is A2 { function f() public virtual override {} }
+contract C3 is A2 { function f() public virtual override {} }
+contract A3 is B3, C3 { function f() public virtual override(B3, C3) {} }
+contract B4 is A3 { function f() public virtual override {} }
+contract C4 is A3 { function f() public virtual override {} }
+contract A4 is B4, C4 { function f() public virtual override(B4, C4) {} }
+contract B5 is A4 { function f() public virtual override {} }
+contract C5 is A4 { function f() public virtual override {} }
+contract A5 is B5, C5 { function f() public virtual override(B5, C5) {} }
+contract B6 is A5 { function f() public virtual override {} }
+contract C6 is A5 { function f() public virtual override {} }
+contract A6 is B6, C6 { function f() public virtual override(B6, C6) {} }
+contract B7 is A6 { function f() public virtual override {} }
+contract C7 is A6 { function f() public virtual override {} }
+contract A7 is B7, C7 { function f() public virtual override(B7, C7) {} }
+contract B8 is A7 { function f() public virtual override {} }
+contract C8 is A7 { function f() public virtual override {} }
+contract A8 is B8, C8 { function f() public virtual override(B8, C8) {} }
+contract B9 is A8 { function f() public virtual override {} }
+contract C9 is A8 { function f() public virtual override {} }
+contract A9 is B9, C9 { function f() public virtual override(B9, C9) {} }
+contract B10 is A9 { function f() public virtual override {} }
+contract C10 is A9 { function f() public virtual override {} }
+contract A10 is B10, C10 { function f() public virtual override(B10, C10) {} }
+contract B11 is A10 { function f() public virtual override {} }
+contract C11 is A10 { function f() public virtual override {} }
+contract A11 is B11, C11 { function f() public virtual override(B11, C11) {} }
+contract B12 is A11 { function f() public virtual override {} }
+contract C12 is A11 { function f() public virtual override {} }
+contract A12 is B12, C12 { function f() public virtual override(B12, C12) {} }
+contract B13 is A12 { function f() public virtual override {} }
+contract C13 is A12 { function f() public virtual override {} }
+contract A13 is B13, C13 { function f() public virtual override(B13, C13) {} }
+contract B14 is A13 { function f() public virtual override {} }
+contract C14 is A13 { function f() public virtual override {} }
+contract A14 is B14, C14 { function f() public virtual override(B14, C14) {} }
+contract B15 is A14 { function f() public virtual override {} }
+contract C15 is A14 { function f() public virtual override {} }
+contract A15 is B15, C15 { function f() public virtual override(B15, C15) {} }
+contract B16 is A15 { function f() public virtual override {} }
+contract C16 is A15 { function f() public virtual override {} }
+contract A16 is B16, C16 { function f() public virtual override(B16, C16) {} }
+contract B17 is A16 { function f() public virtual override {} }
+contract C17 is A16 { function f() public virtual override {} }
+contract A17 is B17, C17 { function f() public virtual override(B17, C17) {} }
+contract B18 is A17 { function f() public virtual override {} }
+contract C18 is A17 { function f() public virtual override {} }
+contract A18 is B18, C18 { function f() public virtual override(B18, C18) {} }
+contract B19 is A18 { function f() public virtual override {} }
+contract C19 is A18 { function f() public virtual override {} }
+contract A19 is B19, C19 { function f() public virtual override(B19, C19) {} }
+contract B20 is A19 { function f() public virtual override {} }
+contract C20 is A19 { function f() public virtual override {} }
+contract A20 is B20, C20 { function f() public virtual override(B20, C20) {} }
+contract B21 is A20 { function f() public virtual override {} }
+contract C21 is A20 { function f() public virtual override {} }
+contract A21 is B21, C21 { function f() public virtual override(B21, C21) {} }
+contract B22 is A21 { function f() public virtual override {} }
+contract C22 is A21 { function f() public virtual override {} }
+contract A22 is B22, C22 { function f() public virtual override(B22, C22) {} }
+contract B23 is A22 { function f() public virtual override {} }
+contract C23 is A22 { function f() public virtual override {} }
+contract A23 is B23, C23 { function f() public virtual override(B23, C23) {} }
+contract B24 is A23 { function f() public virtual override {} }
+contract C24 is A23 { function f() public virtual override {} }
+contract A24 is B24, C24 { function f() public virtual override(B24, C24) {} }
+contract D is A24 { function f() public virtual override {} }
+contract X is A24, D {}
+// ----
+// TypeError: (4994-5017): Derived contract must override function "f". Two or more base classes define function with same name and parameter types.
@@ -53,6 +53,7 @@
 #include <libyul/optimiser/SSATransform.h>
 #include <libyul/optimiser/Semantics.h>
 #include <libyul/optimiser/RedundantAssignEliminator.h>
+#include <libyul/optimiser/RedundantStoreEliminator.h>
 #include <libyul/optimiser/StructuralSimplifier.h>
 #include <libyul/optimiser/StackCompressor.h>
 #include <libyul/optimiser/Suite.h>
@@ -142,6 +143,14 @@ TestCase::TestResult YulOptimizerTest::run(ostream& _stream, string const& _line
 		GasMeter meter(dynamic_cast<EVMDialect const&>(*m_dialect), false, 200);
 		ConstantOptimiser{dynamic_cast<EVMDialect const&>(*m_dialect), meter}(*m_ast);
 	}
+	else if (m_optimizerStep == "constantDataTable")
+	{
+		disambiguate();
+		GasMeter meter(dynamic_cast<EVMDialect const&>(*m_dialect), true, 1);
+		yul::Object obj;
+		obj.code = m_ast;
+		ConstantDataTable::run(dynamic_cast<EVMDialect const&>(*m_dialect), meter, obj, *m_nameDispenser);
+	}
 	else if (m_optimizerStep == "varDeclInitializer")
 		VarDeclInitializer::run(*m_context, *m_ast);
 	else if (m_optimizerStep == "varNameCleaner")
@@ -260,6 +269,11 @@ TestCase::TestResult YulOptimizerTest::run(ostream& _stream, string const& _line
 		disambiguate();
 		RedundantAssignEliminator::run(*m_context, *m_ast);
 	}
+	else if (m_optimizerStep == "redundantStoreEliminator")
+	{
+		disambiguate();
+		RedundantStoreEliminator::run(*m_context, *m_ast);
+	}
 	else if (m_optimizerStep == "ssaPlusCleanup")
 	{
 		disambiguate();